@@ -691,6 +691,9 @@ int mutt_view_attachment(FILE *fp, struct Body *b, enum ViewAttachMode mode,
                   (is_message ? MUTT_PAGER_MESSAGE : MUTT_PAGER_NO_FLAGS) |
                   ((use_mailcap && entry->xneomuttnowrap) ? MUTT_PAGER_NOWRAP :
                                                             MUTT_PAGER_NO_FLAGS);
+    /* The mailcap command's stderr, or pinentry, may have used the terminal */
+    if (use_mailcap || (is_message && b->email && (b->email->security & SEC_ENCRYPT)))
+      pview.flags |= MUTT_PAGER_CLEAR;
     pview.mode = PAGER_MODE_ATTACH;
 
     rc = mutt_do_pager(&pview, e);
@@ -30,9 +30,11 @@
 #include "config.h"
 #include <dirent.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <time.h>
 #include <unistd.h>
 #include "mutt/lib.h"
 #include "config/lib.h"
@@ -42,14 +44,340 @@
 #include "lib.h"
 #include "muttlib.h"
 
+/// Name of the index file, in each cache directory
+#define BCACHE_INDEX ".index"
+/// First line of the index file, identifying its format
+#define BCACHE_INDEX_VERSION "neomutt-bcache 1"
+/// When evicting, shrink the cache to this percentage of $message_cache_size
+#define BCACHE_LOW_WATER 90
+
+/**
+ * struct BcacheEntry - An entry in the Body Cache index
+ */
+struct BcacheEntry
+{
+  char *id;     ///< Per-mailbox unique identifier for the message
+  size_t size;  ///< Size of the cached file
+  time_t atime; ///< Time the entry was last used
+};
+ARRAY_HEAD(BcacheEntryArray, struct BcacheEntry *);
+ARRAY_HEAD(BcacheIdArray, char *);
+
 /**
  * struct BodyCache - Local cache of email bodies
  */
 struct BodyCache
 {
-  char *path; ///< On-disk path to the file
+  char *path;              ///< On-disk path to the file
+  struct HashTable *index; ///< Index of the entries, loaded when first needed
+  size_t size;             ///< Total size of the entries
+  bool dirty;              ///< The index needs to be saved
+  char *last_commit;       ///< Last entry committed, whose size may still change
 };
 
+/**
+ * bcache_entry_free - Free a Body Cache index entry - Implements ::hash_hdata_free_t - @ingroup hash_hdata_free_api
+ */
+static void bcache_entry_free(int type, void *obj, intptr_t data)
+{
+  struct BcacheEntry *entry = obj;
+
+  FREE(&entry->id);
+  FREE(&entry);
+}
+
+/**
+ * bcache_entry_add - Add or update an entry in the Body Cache index
+ * @param bcache Body Cache
+ * @param id     Per-mailbox unique identifier for the message
+ * @param size   Size of the cached file
+ * @param atime  Time the entry was last used
+ * @retval ptr Index entry
+ */
+static struct BcacheEntry *bcache_entry_add(struct BodyCache *bcache,
+                                            const char *id, size_t size, time_t atime)
+{
+  struct BcacheEntry *entry = mutt_hash_find(bcache->index, id);
+  if (entry)
+  {
+    bcache->size -= entry->size;
+  }
+  else
+  {
+    entry = MUTT_MEM_CALLOC(1, struct BcacheEntry);
+    entry->id = mutt_str_dup(id);
+    mutt_hash_insert(bcache->index, entry->id, entry);
+  }
+
+  entry->size = size;
+  entry->atime = atime;
+  bcache->size += size;
+  return entry;
+}
+
+/**
+ * bcache_entry_remove - Remove an entry from the Body Cache index
+ * @param bcache Body Cache
+ * @param id     Per-mailbox unique identifier for the message
+ */
+static void bcache_entry_remove(struct BodyCache *bcache, const char *id)
+{
+  struct BcacheEntry *entry = mutt_hash_find(bcache->index, id);
+  if (!entry)
+    return;
+
+  bcache->size -= entry->size;
+  bcache->dirty = true;
+  mutt_hash_delete(bcache->index, id, entry);
+}
+
+/**
+ * bcache_entry_refresh - Update the size of the last committed entry
+ * @param bcache Body Cache
+ *
+ * The caller may still be writing to the file when it's committed, so its
+ * size is checked again later.
+ */
+static void bcache_entry_refresh(struct BodyCache *bcache)
+{
+  if (!bcache->last_commit)
+    return;
+
+  struct BcacheEntry *entry = mutt_hash_find(bcache->index, bcache->last_commit);
+  if (entry)
+  {
+    struct Buffer *path = buf_pool_get();
+    buf_printf(path, "%s%s", bcache->path, entry->id);
+
+    struct stat st = { 0 };
+    if ((stat(buf_string(path), &st) == 0) && ((size_t) st.st_size != entry->size))
+    {
+      bcache->size += st.st_size - entry->size;
+      entry->size = st.st_size;
+      bcache->dirty = true;
+    }
+    buf_pool_release(&path);
+  }
+
+  FREE(&bcache->last_commit);
+}
+
+/**
+ * bcache_index_scan - Bring the index up to date with the cache directory
+ * @param bcache Body Cache
+ *
+ * Entries for missing files are removed.  New files are added, using their
+ * modification time as the last use.
+ */
+static void bcache_index_scan(struct BodyCache *bcache)
+{
+  DIR *dir = mutt_file_opendir(bcache->path, MUTT_OPENDIR_NONE);
+  if (!dir)
+    return;
+
+  mutt_debug(LL_DEBUG2, "bcache: scanning '%s'\n", bcache->path);
+
+  struct HashTable *old = bcache->index;
+  bcache->index = mutt_hash_new(MAX(old->num_elems, 128), MUTT_HASH_NO_FLAGS);
+  mutt_hash_set_destructor(bcache->index, bcache_entry_free, 0);
+  bcache->size = 0;
+  bcache->dirty = true;
+
+  struct Buffer *path = buf_pool_get();
+  struct dirent *de = NULL;
+  while ((de = readdir(dir)))
+  {
+    /* skip hidden files and uncommitted entries,
+     * and the POP header cache, which may share the directory */
+    const size_t len = mutt_str_len(de->d_name);
+    if ((de->d_name[0] == '.') || ((len > 4) && mutt_str_equal(de->d_name + len - 4, ".tmp")) ||
+        strstr(de->d_name, ".hcache"))
+    {
+      continue;
+    }
+
+    struct BcacheEntry *entry = mutt_hash_find(old, de->d_name);
+    struct stat st = { 0 };
+    buf_printf(path, "%s%s", bcache->path, de->d_name);
+    if ((stat(buf_string(path), &st) < 0) || !S_ISREG(st.st_mode))
+      continue;
+
+    bcache_entry_add(bcache, de->d_name, st.st_size, entry ? entry->atime : st.st_mtime);
+  }
+  closedir(dir);
+  buf_pool_release(&path);
+
+  mutt_hash_free(&old);
+}
+
+/**
+ * bcache_index_get - Get the index of a Body Cache, loading it if necessary
+ * @param bcache Body Cache
+ * @retval ptr Index
+ *
+ * The index is kept in a file in the cache directory.  If the directory has
+ * changed since the file was written, e.g. by another instance of NeoMutt,
+ * the directory is scanned to bring the index up to date.
+ */
+static struct HashTable *bcache_index_get(struct BodyCache *bcache)
+{
+  if (bcache->index)
+    return bcache->index;
+
+  bcache->index = mutt_hash_new(128, MUTT_HASH_NO_FLAGS);
+  mutt_hash_set_destructor(bcache->index, bcache_entry_free, 0);
+  bcache->size = 0;
+  bcache->dirty = false;
+
+  struct stat st_dir = { 0 };
+  if (stat(bcache->path, &st_dir) < 0)
+    return bcache->index;
+
+  struct Buffer *path = buf_pool_get();
+  buf_printf(path, "%s%s", bcache->path, BCACHE_INDEX);
+
+  bool valid = false;
+  struct stat st_index = { 0 };
+  FILE *fp = mutt_file_fopen(buf_string(path), "r");
+  if (fp && (fstat(fileno(fp), &st_index) == 0))
+  {
+    char *line = NULL;
+    size_t linelen = 0;
+    int lineno = 0;
+    while ((line = mutt_file_read_line(line, &linelen, fp, &lineno, MUTT_RL_NO_FLAGS)))
+    {
+      if (lineno == 1)
+      {
+        valid = mutt_str_equal(line, BCACHE_INDEX_VERSION);
+        if (!valid)
+          break;
+        continue;
+      }
+
+      /* <size> <atime> <id> */
+      char *end = NULL;
+      unsigned long long size = strtoull(line, &end, 10);
+      if (*end != ' ')
+        continue;
+      long long atime = strtoll(end + 1, &end, 10);
+      if ((*end != ' ') || (end[1] == '\0'))
+        continue;
+      bcache_entry_add(bcache, end + 1, size, atime);
+    }
+    FREE(&line);
+  }
+  mutt_file_fclose(&fp);
+  buf_pool_release(&path);
+
+  if (!valid || (mutt_file_stat_compare(&st_dir, MUTT_STAT_MTIME, &st_index, MUTT_STAT_MTIME) > 0))
+    bcache_index_scan(bcache);
+
+  return bcache->index;
+}
+
+/**
+ * bcache_entry_sort_atime - Compare two index entries by their last use - Implements ::sort_t - @ingroup sort_api
+ */
+static int bcache_entry_sort_atime(const void *a, const void *b, void *sdata)
+{
+  const struct BcacheEntry *ea = *(struct BcacheEntry const *const *) a;
+  const struct BcacheEntry *eb = *(struct BcacheEntry const *const *) b;
+
+  if (ea->atime < eb->atime)
+    return -1;
+  return (ea->atime > eb->atime);
+}
+
+/**
+ * bcache_evict - Delete the least recently used entries
+ * @param bcache Body Cache
+ * @param keep   Don't delete this entry (OPTIONAL)
+ *
+ * When the cache grows larger than $message_cache_size, delete entries until
+ * it's below the low-water mark.  This leaves room for a few more messages
+ * before the index has to be sorted again.
+ */
+static void bcache_evict(struct BodyCache *bcache, const char *keep)
+{
+  const long c_message_cache_size = cs_subset_long(NeoMutt->sub, "message_cache_size");
+  if ((c_message_cache_size <= 0) || (bcache->size <= (size_t) c_message_cache_size))
+    return;
+
+  const size_t low_water = (size_t) c_message_cache_size / 100 * BCACHE_LOW_WATER;
+
+  struct BcacheEntryArray entries = ARRAY_HEAD_INITIALIZER;
+  struct HashWalkState state = { 0 };
+  struct HashElem *he = NULL;
+  while ((he = mutt_hash_walk(bcache->index, &state)))
+  {
+    struct BcacheEntry *entry = he->data;
+    if (!mutt_str_equal(entry->id, keep))
+      ARRAY_ADD(&entries, entry);
+  }
+  ARRAY_SORT(&entries, bcache_entry_sort_atime, NULL);
+
+  struct Buffer *path = buf_pool_get();
+  struct BcacheEntry **ep = NULL;
+  ARRAY_FOREACH(ep, &entries)
+  {
+    if (bcache->size <= low_water)
+      break;
+
+    buf_printf(path, "%s%s", bcache->path, (*ep)->id);
+    mutt_debug(LL_DEBUG3, "bcache: evict: '%s'\n", buf_string(path));
+    if ((unlink(buf_string(path)) == 0) || (errno == ENOENT))
+      bcache_entry_remove(bcache, (*ep)->id);
+  }
+
+  buf_pool_release(&path);
+  ARRAY_FREE(&entries);
+}
+
+/**
+ * bcache_index_save - Save the index of a Body Cache
+ * @param bcache Body Cache
+ *
+ * The file is rewritten in place, so that the directory's modification time
+ * only changes when entries are added or removed.
+ */
+static void bcache_index_save(struct BodyCache *bcache)
+{
+  if (!bcache->index)
+    return;
+
+  bcache_entry_refresh(bcache);
+  bcache_evict(bcache, NULL);
+  if (!bcache->dirty)
+    return;
+
+  struct Buffer *path = buf_pool_get();
+  buf_printf(path, "%s%s", bcache->path, BCACHE_INDEX);
+
+  FILE *fp = mutt_file_fopen(buf_string(path), "w");
+  if (!fp)
+  {
+    mutt_debug(LL_DEBUG1, "bcache: can't save index '%s'\n", buf_string(path));
+    buf_pool_release(&path);
+    return;
+  }
+
+  fprintf(fp, "%s\n", BCACHE_INDEX_VERSION);
+
+  struct HashWalkState state = { 0 };
+  struct HashElem *he = NULL;
+  while ((he = mutt_hash_walk(bcache->index, &state)))
+  {
+    struct BcacheEntry *entry = he->data;
+    fprintf(fp, "%zu %lld %s\n", entry->size, (long long) entry->atime, entry->id);
+  }
+
+  if (mutt_file_fclose(&fp) == 0)
+    bcache->dirty = false;
+
+  mutt_debug(LL_DEBUG3, "bcache: saved index '%s'\n", buf_string(path));
+  buf_pool_release(&path);
+}
+
 /**
  * bcache_path - Create the cache path for a given account/mailbox
  * @param account Account info
@@ -170,6 +498,9 @@ void mutt_bcache_close(struct BodyCache **ptr)
     return;
 
   struct BodyCache *bcache = *ptr;
+  bcache_index_save(bcache);
+  mutt_hash_free(&bcache->index);
+  FREE(&bcache->last_commit);
   FREE(&bcache->path);
 
   FREE(ptr);
@@ -195,6 +526,17 @@ FILE *mutt_bcache_get(struct BodyCache *bcache, const char *id)
 
   mutt_debug(LL_DEBUG3, "bcache: get: '%s': %s\n", buf_string(path), fp ? "yes" : "no");
 
+  /* record the use, for the LRU eviction */
+  if (fp)
+  {
+    struct BcacheEntry *entry = mutt_hash_find(bcache_index_get(bcache), id);
+    if (entry)
+    {
+      entry->atime = mutt_date_now();
+      bcache->dirty = true;
+    }
+  }
+
   buf_pool_release(&path);
   return fp;
 }
@@ -256,6 +598,24 @@ int mutt_bcache_commit(struct BodyCache *bcache, const char *id)
 
   int rc = mutt_bcache_move(bcache, buf_string(tmpid), id);
   buf_pool_release(&tmpid);
+  if (rc != 0)
+    return rc;
+
+  struct Buffer *path = buf_pool_get();
+  buf_printf(path, "%s%s", bcache->path, id);
+
+  struct stat st = { 0 };
+  if (stat(buf_string(path), &st) == 0)
+  {
+    bcache_index_get(bcache);
+    bcache_entry_refresh(bcache);
+    bcache_entry_add(bcache, id, st.st_size, mutt_date_now());
+    bcache->last_commit = mutt_str_dup(id);
+    bcache->dirty = true;
+    bcache_evict(bcache, id);
+  }
+
+  buf_pool_release(&path);
   return rc;
 }
 
@@ -279,6 +639,9 @@ int mutt_bcache_del(struct BodyCache *bcache, const char *id)
 
   int rc = unlink(buf_string(path));
   buf_pool_release(&path);
+
+  bcache_index_get(bcache);
+  bcache_entry_remove(bcache, id);
   return rc;
 }
 
@@ -330,41 +693,48 @@ int mutt_bcache_exists(struct BodyCache *bcache, const char *id)
  * listing is aborted and continued otherwise. The callback is optional
  * so that this function can be used to count the items in the cache
  * (see below for return value).
+ *
+ * The entries are taken from the cache's index, rather than the directory.
  */
 int mutt_bcache_list(struct BodyCache *bcache, bcache_list_t want_id, void *data)
 {
-  DIR *dir = NULL;
-  struct dirent *de = NULL;
-  int rc = -1;
-
-  if (!bcache || !(dir = mutt_file_opendir(bcache->path, MUTT_OPENDIR_NONE)))
-    goto out;
+  if (!bcache)
+    return -1;
 
-  rc = 0;
+  struct stat st = { 0 };
+  if ((stat(bcache->path, &st) < 0) || !S_ISDIR(st.st_mode))
+    return -1;
 
   mutt_debug(LL_DEBUG3, "bcache: list: dir: '%s'\n", bcache->path);
 
-  while ((de = readdir(dir)))
+  /* The callback may delete entries, so copy the ids first */
+  struct BcacheIdArray ids = ARRAY_HEAD_INITIALIZER;
+  struct HashWalkState state = { 0 };
+  struct HashElem *he = NULL;
+  while ((he = mutt_hash_walk(bcache_index_get(bcache), &state)))
   {
-    if (mutt_str_startswith(de->d_name, ".") || mutt_str_startswith(de->d_name, ".."))
-    {
-      continue;
-    }
+    struct BcacheEntry *entry = he->data;
+    ARRAY_ADD(&ids, mutt_str_dup(entry->id));
+  }
 
-    mutt_debug(LL_DEBUG3, "bcache: list: dir: '%s', id :'%s'\n", bcache->path, de->d_name);
+  int rc = 0;
+  char **idp = NULL;
+  ARRAY_FOREACH(idp, &ids)
+  {
+    mutt_debug(LL_DEBUG3, "bcache: list: dir: '%s', id :'%s'\n", bcache->path, *idp);
 
-    if (want_id && (want_id(de->d_name, bcache, data) != 0))
-      goto out;
+    if (want_id && (want_id(*idp, bcache, data) != 0))
+      break;
 
     rc++;
   }
 
-out:
-  if (dir)
+  ARRAY_FOREACH(idp, &ids)
   {
-    if (closedir(dir) < 0)
-      rc = -1;
+    FREE(idp);
   }
+  ARRAY_FREE(&ids);
+
   mutt_debug(LL_DEBUG3, "bcache: list: did %d entries\n", rc);
   return rc;
 }
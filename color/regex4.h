@@ -41,6 +41,7 @@ struct RegexColor
   struct PatternList *color_pattern; ///< Compiled pattern to speed up index color calculation
 
   bool stop_matching : 1;            ///< Used by the pager for body patterns, to prevent the color from being retried once it fails
+  regmatch_t next_match;             ///< Used by the pager for body patterns, next match in the current line
 
   STAILQ_ENTRY(RegexColor) entries;  ///< Linked list
 };
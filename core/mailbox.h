@@ -103,6 +103,8 @@ struct Mailbox
   bool newly_created;                 ///< Mbox or mmdf just popped into existence
   struct timespec last_visited;       ///< Time of last exit from this mailbox
   time_t last_checked;                ///< Last time we checked this mailbox for new mail
+  short poll_skip;                    ///< Number of polling rounds to skip, see $mail_check_timeout
+  short poll_backoff;                 ///< Rounds to skip next time the check is slow
 
   const struct MxOps *mx_ops;         ///< MXAPI callback functions
 
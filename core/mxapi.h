@@ -64,6 +64,7 @@ enum MxStatus
   MX_STATUS_LOCKED,     ///< Couldn't lock the Mailbox
   MX_STATUS_REOPENED,   ///< Mailbox was reopened
   MX_STATUS_FLAGS,      ///< Nondestructive flags change (IMAP)
+  MX_STATUS_BACKFILL,   ///< Older Emails were fetched in the background (IMAP)
 };
 
 /**
@@ -1954,6 +1954,18 @@
 ** mileage may vary.
 */
 
+{ "imap_connections", DT_NUMBER, 1 },
+/*
+** .pp
+** The number of connections NeoMutt may open to each IMAP account.  If this
+** is greater than 1, the extra connections are used for background work,
+** such as checking other mailboxes for new mail.  They don't have to wait for
+** the connection of the open mailbox, and it doesn't have to wait for them.
+** .pp
+** The extra connections are opened when they're first needed.
+** \fBNote:\fP Some servers limit the number of connections per user.
+*/
+
 #ifdef USE_ZLIB
 { "imap_deflate", DT_BOOL, true },
 /*
@@ -1985,6 +1997,18 @@
 ** headers.
 */
 
+{ "imap_fetch_window", DT_NUMBER, 0 },
+/*
+** .pp
+** When set to a value greater than 0, opening a mailbox will only download
+** the headers of the newest $$imap_fetch_window messages that aren't in the
+** header cache.  The mailbox can be used straight away.
+** .pp
+** The older headers are downloaded, a block of this size at a time, while
+** NeoMutt is waiting for input (see $$timeout).  They are added to the index
+** every ten blocks, and when the last block has arrived.
+*/
+
 { "imap_headers", DT_STRING, 0 },
 /*
 ** .pp
@@ -2022,6 +2046,18 @@
 ** getting disconnected from your IMAP server due to inactivity.
 */
 
+{ "imap_list_status", DT_BOOL, true },
+/*
+** .pp
+** When \fIset\fP, and the server supports the LIST-STATUS extension (RFC5819),
+** NeoMutt will fetch the message counts of all the polled mailboxes of an
+** account using a single LIST command, rather than one STATUS command per
+** mailbox.
+** .pp
+** If the server doesn't support LIST-STATUS, the STATUS commands are
+** pipelined, see $$imap_pipeline_depth.
+*/
+
 { "imap_list_subscribed", DT_BOOL, false },
 /*
 ** .pp
@@ -2038,6 +2074,19 @@
 ** This variable defaults to the value of $$imap_user.
 */
 
+{ "imap_notify", DT_BOOL, false },
+/*
+** .pp
+** When \fIset\fP, and the server supports the NOTIFY extension (RFC5465),
+** NeoMutt will ask the server to send updates for all the polled mailboxes of
+** an account.  Checking those mailboxes for new mail no longer needs any
+** commands to be sent; NeoMutt just reads the updates the server has pushed.
+** .pp
+** Note: this feature is currently experimental.  If you experience
+** strange behavior, such as missing new mail notifications, please
+** file a bug report to let us know.
+*/
+
 { "imap_oauth_refresh_command", D_STRING_COMMAND, 0 },
 /*
 ** .pp
@@ -2099,6 +2148,27 @@
 ** to 0 to disable timing out.
 */
 
+{ "imap_prefetch", DT_NUMBER, 0 },
+/*
+** .pp
+** When set to a value greater than zero, NeoMutt will use the time you
+** spend idle in the index or pager to download message bodies into the
+** $$message_cache_dir.  First the $$imap_prefetch messages following the
+** last one you read are fetched, then any unread messages in the mailbox.
+** Messages are fetched with BODY.PEEK, so they are not marked as read.
+** .pp
+** The amount of data downloaded is limited by $$imap_prefetch_limit and
+** the size of the cache by $$message_cache_size.
+*/
+
+{ "imap_prefetch_limit", DT_LONG, 262144 },
+/*
+** .pp
+** This variable limits the number of bytes that $$imap_prefetch will
+** download each second.  Messages larger than this are not prefetched.
+** Set to 0 to remove the size limit and fetch one message per second.
+*/
+
 { "imap_qresync", DT_BOOL, false },
 /*
 ** .pp
@@ -2401,6 +2471,21 @@
 ** how often (in seconds) NeoMutt will update message counts.
 */
 
+{ "mail_check_timeout", DT_NUMBER, 250 },
+/*
+** .pp
+** This variable limits the time (in milliseconds) that NeoMutt will spend
+** checking mailboxes for new mail, before returning to the user.  If the
+** limit is reached, the remaining mailboxes are checked the next time
+** NeoMutt is idle.
+** .pp
+** A mailbox that takes longer than this to check on its own, e.g. a slow
+** network filesystem, will be checked less often.
+** .pp
+** The limit doesn't apply to C<check-stats>P or C-ZP.
+** Set to 0 to check every mailbox in one go.
+*/
+
 { "mailbox_folder_format", DT_STRING, "%2C %<n?%6n&      > %6m %i" },
 /*
 ** .pp
@@ -2580,7 +2665,19 @@
 ** remote message only once and can perform regular expression searches
 ** as fast as for local folders.
 ** .pp
-** Also see the $$message_cache_clean variable.
+** Also see the $$message_cache_clean and $$message_cache_size variables.
+*/
+
+{ "message_cache_size", DT_LONG, 0 },
+/*
+** .pp
+** The maximum size, in bytes, of the message cache of each mailbox.  When a
+** message is added to a cache that has grown larger than this, the least
+** recently used messages are deleted from it, until it's 90% of this size.
+** .pp
+** A value of 0 means the size is unlimited.
+** .pp
+** Also see the $$message_cache_dir variable.
 */
 
 { "message_format", DT_STRING, "%s" },
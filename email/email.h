@@ -105,12 +105,15 @@ struct Email
   bool searched        : 1;    ///< Email has been searched
   bool subject_changed : 1;    ///< Used for threading
   bool tagged          : 1;    ///< Email is tagged
+  bool score_final     : 1;    ///< An exact score rule matched, ignore later rules
   bool threaded        : 1;    ///< Used for threading
 
   int index;                   ///< The absolute (unsorted) message number
   int msgno;                   ///< Number displayed to the user
   const struct AttrColor *attr_color; ///< Color-pair to use when displaying in the index
   int score;                   ///< Message score
+  int score_sum;               ///< Unclamped total of the matching score rules
+  int score_gen;               ///< Generation of the score rules last applied
   int vnum;                    ///< Virtual message number
   short attach_total;          ///< Number of qualifying attachments in message, if attach_valid
   short recipient;             ///< User_is_recipient()'s return value, cached
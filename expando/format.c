@@ -108,6 +108,27 @@ void buf_justify(struct Buffer *buf, enum FormatJustify justify, size_t max_cols
 int format_string(struct Buffer *buf, int min_cols, int max_cols, enum FormatJustify justify,
                   char pad_char, const char *str, size_t n, bool arboreal)
 {
+  // Fast path: printable ASCII uses one screen column per byte
+  size_t ascii = 0;
+  while ((ascii < n) && (str[ascii] >= ' ') && (str[ascii] <= '~'))
+    ascii++;
+
+  if (ascii == n)
+  {
+    const size_t len = (max_cols > 0) ? MIN(n, (size_t) max_cols) : 0;
+    buf_addstr_n(buf, str, len);
+
+    int used_cols = len;
+    const int pad = min_cols - len;
+    if (pad > 0)
+    {
+      used_cols += pad;
+      buf_justify(buf, justify, buf_len(buf) + pad, pad_char);
+    }
+
+    return used_cols;
+  }
+
   wchar_t wc = 0;
   int w = 0;
   size_t k = 0;
@@ -411,14 +411,23 @@ int node_expando_render(const struct ExpandoNode *node,
   struct Buffer *buf_format = buf_pool_get();
 
   const struct ExpandoFormat *fmt = node->format;
-  const struct NodeExpandoPrivate *priv = node->ndata;
+  struct NodeExpandoPrivate *priv = node->ndata;
 
   // ---------------------------------------------------------------------------
   // Numbers and strings get treated slightly differently. We prefer strings.
   // This allows dates to be stored as 1729850182, but displayed as "2024-10-25".
 
-  const struct ExpandoRenderCallback *erc_match = find_get_string(erc, node->did, node->uid);
-  if (erc_match)
+  // The Expando is usually rendered with the same callbacks, so remember the match
+  if (priv->erc != erc)
+  {
+    priv->erc_match = find_get_string(erc, node->did, node->uid);
+    if (!priv->erc_match)
+      priv->erc_match = find_get_number(erc, node->did, node->uid);
+    priv->erc = erc;
+  }
+
+  const struct ExpandoRenderCallback *erc_match = priv->erc_match;
+  if (erc_match && erc_match->get_string)
   {
     erc_match->get_string(node, data, flags, buf_expando);
 
@@ -427,7 +436,6 @@ int node_expando_render(const struct ExpandoNode *node,
   }
   else
   {
-    erc_match = find_get_number(erc, node->did, node->uid);
     ASSERT(erc_match && "Unknown UID");
 
     const long num = erc_match->get_number(node, data, flags);
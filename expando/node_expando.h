@@ -40,6 +40,9 @@ struct NodeExpandoPrivate
 {
   int color;         ///< ColorId to use
   bool has_tree;     ///< Contains tree characters, used in $index_format's %s
+
+  const struct ExpandoRenderCallback *erc;       ///< Render callbacks that were searched
+  const struct ExpandoRenderCallback *erc_match; ///< Cached callback from erc
 };
 
 struct ExpandoNode *node_expando_new(struct ExpandoFormat *fmt, int did, int uid);
@@ -45,8 +45,27 @@ static int node_text_render(const struct ExpandoNode *node,
 {
   ASSERT(node->type == ENT_TEXT);
 
+  const struct NodeTextPrivate *priv = node->ndata;
+  if (priv->ascii && (max_cols >= 0) && (priv->len <= (size_t) max_cols))
+  {
+    buf_addstr_n(buf, node->text, priv->len);
+    return priv->len;
+  }
+
   return format_string(buf, 0, max_cols, JUSTIFY_LEFT, ' ', node->text,
-                       mutt_str_len(node->text), false);
+                       priv->len, false);
+}
+
+/**
+ * node_text_private_free - Free Text private data - Implements ExpandoNode::ndata_free()
+ * @param ptr Data to free
+ */
+static void node_text_private_free(void **ptr)
+{
+  if (!ptr || !*ptr)
+    return;
+
+  FREE(ptr);
 }
 
 /**
@@ -64,6 +83,22 @@ struct ExpandoNode *node_text_new(const char *text)
   node->text = mutt_str_dup(text);
   node->render = node_text_render;
 
+  // Measure the text once, rather than every time it's rendered
+  struct NodeTextPrivate *priv = MUTT_MEM_CALLOC(1, struct NodeTextPrivate);
+  priv->len = mutt_str_len(node->text);
+  priv->ascii = true;
+  for (size_t i = 0; i < priv->len; i++)
+  {
+    if ((node->text[i] < ' ') || (node->text[i] > '~'))
+    {
+      priv->ascii = false;
+      break;
+    }
+  }
+
+  node->ndata = priv;
+  node->ndata_free = node_text_private_free;
+
   return node;
 }
 
@@ -24,6 +24,8 @@
 #ifndef MUTT_EXPANDO_NODE_TEXT_H
 #define MUTT_EXPANDO_NODE_TEXT_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /**
@@ -35,6 +37,15 @@ typedef uint8_t NodeTextTermFlags;    ///< Flags, e.g. #NTE_NO_FLAGS
 #define NTE_GREATER         (1 <<  1) ///< '>' Greater than
 #define NTE_QUESTION        (1 <<  2) ///< '?' Question mark
 
+/**
+ * struct NodeTextPrivate - Private data for a Text Node - @extends ExpandoNode
+ */
+struct NodeTextPrivate
+{
+  size_t len;        ///< Length of the text in bytes
+  bool ascii;        ///< Text is printable ASCII, so its width is its length
+};
+
 struct ExpandoNode *node_text_new(const char *text);
 struct ExpandoNode *node_text_parse(const char *str, NodeTextTermFlags term_chars, const char **parsed_until);
 
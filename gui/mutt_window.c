@@ -711,8 +711,11 @@ const char *mutt_window_win_name(const struct MuttWindow *win)
 /**
  * window_invalidate - Mark a window as in need of repaint
  * @param win   Window to start at
+ *
+ * Unlike window_invalidate_all(), the screen isn't cleared, so curses will
+ * only send the parts that have changed to the terminal.
  */
-static void window_invalidate(struct MuttWindow *win)
+void window_invalidate(struct MuttWindow *win)
 {
   if (!win)
     return;
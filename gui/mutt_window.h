@@ -272,6 +272,7 @@ struct MuttWindow *window_get_focus  (void);
 bool               window_is_focused (const struct MuttWindow *win);
 
 void window_redraw(struct MuttWindow *win);
+void window_invalidate(struct MuttWindow *win);
 void window_invalidate_all(void);
 const char *mutt_window_win_name(const struct MuttWindow *win);
 bool window_status_on_top(struct MuttWindow *panel, const struct ConfigSubset *sub);
@@ -71,13 +71,29 @@ struct Hook
   char *source_file;           ///< Used for relative-directory source
   struct PatternList *pattern; ///< Used for fcc,save,send-hook
   struct Expando *expando;     ///< Used for format hooks
+  char *literal;               ///< Regex is just this plain string
+  bool literal_start;          ///< Literal is anchored to the start, `^`
+  bool literal_end;            ///< Literal is anchored to the end, `$`
+  struct Hook *twin;           ///< Earliest Hook of the same type with the same pattern
+  int eval_gen;                ///< HookEvalGen when the pattern was last evaluated
+  bool eval_match;             ///< Result of that evaluation
   TAILQ_ENTRY(Hook) entries;   ///< Linked list
 };
 TAILQ_HEAD(HookList, Hook);
+ARRAY_HEAD(HookArray, struct Hook *);
+
+/// Number of hook types, one for each bit of #HookFlags
+#define HOOK_NUM_TYPES 20
 
 /// All simple hooks, e.g. MUTT_FOLDER_HOOK
 static struct HookList Hooks = TAILQ_HEAD_INITIALIZER(Hooks);
 
+/// Hooks of each type, in the order they were defined
+static struct HookArray HookIndex[HOOK_NUM_TYPES];
+
+/// Generation of pattern results, see hook_pattern_match()
+static int HookEvalGen = 0;
+
 /// All Index Format hooks
 static struct HashTable *IdxFmtHooks = NULL;
 
@@ -105,6 +121,7 @@ static void hook_free(struct Hook **ptr)
   }
   mutt_pattern_free(&h->pattern);
   expando_free(&h->expando);
+  FREE(&h->literal);
   FREE(ptr);
 }
 
@@ -117,6 +134,184 @@ static struct Hook *hook_new(void)
   return MUTT_MEM_CALLOC(1, struct Hook);
 }
 
+/**
+ * hook_index_get - Get the list of Hooks of one type
+ * @param type Hook type, e.g. #MUTT_FOLDER_HOOK
+ * @retval ptr Array of Hooks, in the order they were defined
+ *
+ * @note If more than one type is given, only the first is used
+ */
+static struct HookArray *hook_index_get(HookFlags type)
+{
+  int i = 0;
+  while ((i < (HOOK_NUM_TYPES - 1)) && !(type & (1 << i)))
+    i++;
+
+  return &HookIndex[i];
+}
+
+/**
+ * hook_index_add - Add a Hook to the index
+ * @param hook Hook to add
+ *
+ * Hooks that share a pattern are linked together, so it only needs to be
+ * evaluated once.
+ */
+static void hook_index_add(struct Hook *hook)
+{
+  if (hook->pattern)
+  {
+    struct Hook **hp = NULL;
+    ARRAY_FOREACH(hp, hook_index_get(hook->type))
+    {
+      if (((*hp)->type == hook->type) &&
+          mutt_str_equal((*hp)->regex.pattern, hook->regex.pattern))
+      {
+        hook->twin = (*hp)->twin ? (*hp)->twin : *hp;
+        break;
+      }
+    }
+  }
+
+  for (int i = 0; i < HOOK_NUM_TYPES; i++)
+  {
+    if (hook->type & (1 << i))
+      ARRAY_ADD(&HookIndex[i], hook);
+  }
+}
+
+/**
+ * hook_index_remove - Remove a Hook from the index
+ * @param hook Hook to remove
+ */
+static void hook_index_remove(struct Hook *hook)
+{
+  for (int i = 0; i < HOOK_NUM_TYPES; i++)
+  {
+    if (!(hook->type & (1 << i)))
+      continue;
+
+    struct Hook **hp = NULL;
+    ARRAY_FOREACH(hp, &HookIndex[i])
+    {
+      if (*hp == hook)
+      {
+        ARRAY_REMOVE(&HookIndex[i], hp);
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * hook_set_literal - Check whether a Hook's regex is a plain string
+ * @param hook Hook to examine
+ *
+ * Many regexes, e.g. escaped mailbox paths, contain no special characters.
+ * They can be matched with a simple string comparison.
+ */
+static void hook_set_literal(struct Hook *hook)
+{
+  const char *pat = hook->regex.pattern;
+  if (!pat)
+    return;
+
+  const char *special = "^.[$()|*+?{\\";
+  struct Buffer *buf = buf_pool_get();
+  bool anchor_start = false;
+  bool anchor_end = false;
+
+  if (*pat == '^')
+  {
+    anchor_start = true;
+    pat++;
+  }
+
+  for (; *pat; pat++)
+  {
+    if ((pat[0] == '$') && (pat[1] == '\0'))
+    {
+      anchor_end = true;
+      break;
+    }
+
+    if (*pat == '\\')
+    {
+      // Only escaped special characters are literal, e.g. not \w or \<
+      pat++;
+      if ((*pat == '\0') || !strchr(special, *pat))
+        goto done;
+    }
+    else if (strchr(special, *pat))
+    {
+      goto done;
+    }
+
+    buf_addch(buf, *pat);
+  }
+
+  hook->literal = buf_strdup(buf);
+  hook->literal_start = anchor_start;
+  hook->literal_end = anchor_end;
+
+done:
+  buf_pool_release(&buf);
+}
+
+/**
+ * hook_regex_match - Does a Hook's regex match a string?
+ * @param hook Hook
+ * @param str  String to match
+ * @retval true The string matches
+ */
+static bool hook_regex_match(const struct Hook *hook, const char *str)
+{
+  if (!hook->literal)
+    return mutt_regex_match(&hook->regex, str);
+
+  if (!str)
+    return false;
+
+  const size_t lit_len = mutt_str_len(hook->literal);
+  const size_t str_len = mutt_str_len(str);
+  bool match = false;
+
+  if (hook->literal_start && hook->literal_end)
+    match = mutt_str_equal(str, hook->literal);
+  else if (hook->literal_start)
+    match = mutt_strn_equal(str, hook->literal, lit_len);
+  else if (hook->literal_end)
+    match = (str_len >= lit_len) && mutt_str_equal(str + str_len - lit_len, hook->literal);
+  else
+    match = (strstr(str, hook->literal) != NULL);
+
+  return match ^ hook->regex.pat_not;
+}
+
+/**
+ * hook_pattern_match - Does a Hook's pattern match an Email?
+ * @param hook  Hook
+ * @param m     Mailbox
+ * @param e     Email
+ * @param cache Cached Pattern results
+ * @retval true The Email matches
+ *
+ * The result is shared between Hooks with the same pattern, until
+ * HookEvalGen changes.
+ */
+static bool hook_pattern_match(struct Hook *hook, struct Mailbox *m,
+                               struct Email *e, struct PatternCache *cache)
+{
+  struct Hook *root = hook->twin ? hook->twin : hook;
+  if (root->eval_gen != HookEvalGen)
+  {
+    root->eval_match = (mutt_pattern_exec(SLIST_FIRST(root->pattern), 0, m, e, cache) > 0);
+    root->eval_gen = HookEvalGen;
+  }
+
+  return root->eval_match ^ hook->regex.pat_not;
+}
+
 /**
  * mutt_parse_charset_iconv_hook - Parse 'charset-hook' and 'iconv-hook' commands - Implements Command::parse() - @ingroup command_parse
  */
@@ -379,8 +574,11 @@ enum CommandResult mutt_parse_hook(struct Buffer *buf, struct Buffer *s,
   hook->regex.regex = rx;
   hook->regex.pat_not = pat_not;
   hook->expando = exp;
+  if (rx && !(data & MUTT_CRYPT_HOOK))
+    hook_set_literal(hook);
 
   TAILQ_INSERT_TAIL(&Hooks, hook, entries);
+  hook_index_add(hook);
   rc = MUTT_CMD_SUCCESS;
 
 cleanup:
@@ -405,9 +603,16 @@ void mutt_delete_hooks(HookFlags type)
     if ((type == MUTT_HOOK_NO_FLAGS) || (type == h->type))
     {
       TAILQ_REMOVE(&Hooks, h, entries);
+      hook_index_remove(h);
       hook_free(&h);
     }
   }
+
+  if (type == MUTT_HOOK_NO_FLAGS)
+  {
+    for (int i = 0; i < HOOK_NUM_TYPES; i++)
+      ARRAY_FREE(&HookIndex[i]);
+  }
 }
 
 /**
@@ -634,23 +839,21 @@ void mutt_folder_hook(const char *path, const char *desc)
   if (!path && !desc)
     return;
 
-  struct Hook *hook = NULL;
+  struct Hook **hp = NULL;
   struct Buffer *err = buf_pool_get();
 
   CurrentHookType = MUTT_FOLDER_HOOK;
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  ARRAY_FOREACH(hp, hook_index_get(MUTT_FOLDER_HOOK))
   {
+    struct Hook *hook = *hp;
     if (!hook->command)
       continue;
 
-    if (!(hook->type & MUTT_FOLDER_HOOK))
-      continue;
-
     const char *match = NULL;
-    if (mutt_regex_match(&hook->regex, path))
+    if (hook_regex_match(hook, path))
       match = path;
-    else if (mutt_regex_match(&hook->regex, desc))
+    else if (hook_regex_match(hook, desc))
       match = desc;
 
     if (match)
@@ -679,15 +882,12 @@ void mutt_folder_hook(const char *path, const char *desc)
  */
 char *mutt_find_hook(HookFlags type, const char *pat)
 {
-  struct Hook *tmp = NULL;
+  struct Hook **hp = NULL;
 
-  TAILQ_FOREACH(tmp, &Hooks, entries)
+  ARRAY_FOREACH(hp, hook_index_get(type))
   {
-    if (tmp->type & type)
-    {
-      if (mutt_regex_match(&tmp->regex, pat))
-        return tmp->command;
-    }
+    if (hook_regex_match(*hp, pat))
+      return (*hp)->command;
   }
   return NULL;
 }
@@ -700,34 +900,33 @@ char *mutt_find_hook(HookFlags type, const char *pat)
  */
 void mutt_message_hook(struct Mailbox *m, struct Email *e, HookFlags type)
 {
-  struct Hook *hook = NULL;
+  struct Hook **hp = NULL;
   struct PatternCache cache = { 0 };
   struct Buffer *err = buf_pool_get();
 
   CurrentHookType = type;
+  HookEvalGen++;
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  ARRAY_FOREACH(hp, hook_index_get(type))
   {
+    struct Hook *hook = *hp;
     if (!hook->command)
       continue;
 
-    if (hook->type & type)
+    if (hook_pattern_match(hook, m, e, &cache))
     {
-      if ((mutt_pattern_exec(SLIST_FIRST(hook->pattern), 0, m, e, &cache) > 0) ^
-          hook->regex.pat_not)
+      if (parse_rc_line_cwd(hook->command, hook->source_file, err) == MUTT_CMD_ERROR)
       {
-        if (parse_rc_line_cwd(hook->command, hook->source_file, err) == MUTT_CMD_ERROR)
-        {
-          mutt_error("%s", buf_string(err));
-          CurrentHookType = MUTT_HOOK_NO_FLAGS;
-          buf_pool_release(&err);
+        mutt_error("%s", buf_string(err));
+        CurrentHookType = MUTT_HOOK_NO_FLAGS;
+        buf_pool_release(&err);
 
-          return;
-        }
-        /* Executing arbitrary commands could affect the pattern results,
-         * so the cache has to be wiped */
-        memset(&cache, 0, sizeof(cache));
+        return;
       }
+      /* Executing arbitrary commands could affect the pattern results,
+       * so the caches have to be wiped */
+      memset(&cache, 0, sizeof(cache));
+      HookEvalGen++;
     }
   }
   buf_pool_release(&err);
@@ -746,25 +945,24 @@ void mutt_message_hook(struct Mailbox *m, struct Email *e, HookFlags type)
  */
 static int addr_hook(struct Buffer *path, HookFlags type, struct Mailbox *m, struct Email *e)
 {
-  struct Hook *hook = NULL;
+  struct Hook **hp = NULL;
   struct PatternCache cache = { 0 };
 
+  HookEvalGen++;
+
   /* determine if a matching hook exists */
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  ARRAY_FOREACH(hp, hook_index_get(type))
   {
+    struct Hook *hook = *hp;
     if (!hook->command)
       continue;
 
-    if (hook->type & type)
+    if (hook_pattern_match(hook, m, e, &cache))
     {
-      if ((mutt_pattern_exec(SLIST_FIRST(hook->pattern), 0, m, e, &cache) > 0) ^
-          hook->regex.pat_not)
-      {
-        buf_alloc(path, PATH_MAX);
-        mutt_make_string(path, -1, hook->expando, m, -1, e, MUTT_FORMAT_PLAIN, NULL);
-        buf_fix_dptr(path);
-        return 0;
-      }
+      buf_alloc(path, PATH_MAX);
+      mutt_make_string(path, -1, hook->expando, m, -1, e, MUTT_FORMAT_PLAIN, NULL);
+      buf_fix_dptr(path);
+      return 0;
     }
   }
 
@@ -858,13 +1056,13 @@ void mutt_select_fcc(struct Buffer *path, struct Email *e)
  */
 static void list_hook(struct ListHead *matches, const char *match, HookFlags type)
 {
-  struct Hook *tmp = NULL;
+  struct Hook **hp = NULL;
 
-  TAILQ_FOREACH(tmp, &Hooks, entries)
+  ARRAY_FOREACH(hp, hook_index_get(type))
   {
-    if ((tmp->type & type) && mutt_regex_match(&tmp->regex, match))
+    if (hook_regex_match(*hp, match))
     {
-      mutt_list_insert_tail(matches, mutt_str_dup(tmp->command));
+      mutt_list_insert_tail(matches, mutt_str_dup((*hp)->command));
     }
   }
 }
@@ -894,15 +1092,16 @@ void mutt_account_hook(const char *url)
   if (inhook)
     return;
 
-  struct Hook *hook = NULL;
+  struct Hook **hp = NULL;
   struct Buffer *err = buf_pool_get();
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  ARRAY_FOREACH(hp, hook_index_get(MUTT_ACCOUNT_HOOK))
   {
-    if (!(hook->command && (hook->type & MUTT_ACCOUNT_HOOK)))
+    struct Hook *hook = *hp;
+    if (!hook->command)
       continue;
 
-    if (mutt_regex_match(&hook->regex, url))
+    if (hook_regex_match(hook, url))
     {
       inhook = true;
       mutt_debug(LL_DEBUG1, "account-hook '%s' matches '%s'\n", hook->regex.pattern, url);
@@ -932,12 +1131,13 @@ done:
  */
 void mutt_timeout_hook(void)
 {
-  struct Hook *hook = NULL;
+  struct Hook **hp = NULL;
   struct Buffer *err = buf_pool_get();
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  ARRAY_FOREACH(hp, hook_index_get(MUTT_TIMEOUT_HOOK))
   {
-    if (!(hook->command && (hook->type & MUTT_TIMEOUT_HOOK)))
+    struct Hook *hook = *hp;
+    if (!hook->command)
       continue;
 
     if (parse_rc_line_cwd(hook->command, hook->source_file, err) == MUTT_CMD_ERROR)
@@ -964,12 +1164,13 @@ void mutt_timeout_hook(void)
  */
 void mutt_startup_shutdown_hook(HookFlags type)
 {
-  struct Hook *hook = NULL;
+  struct Hook **hp = NULL;
   struct Buffer *err = buf_pool_get();
 
-  TAILQ_FOREACH(hook, &Hooks, entries)
+  ARRAY_FOREACH(hp, hook_index_get(type))
   {
-    if (!(hook->command && (hook->type & type)))
+    struct Hook *hook = *hp;
+    if (!hook->command)
       continue;
 
     if (parse_rc_line_cwd(hook->command, hook->source_file, err) == MUTT_CMD_ERROR)
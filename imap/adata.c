@@ -33,6 +33,7 @@
 #include "core/lib.h"
 #include "conn/lib.h"
 #include "adata.h"
+#include "mdata.h"
 #include "lib.h"
 
 /**
@@ -53,11 +54,53 @@ static int imap_timeout_observer(struct NotifyCallback *nc)
   time_t now = mutt_date_now();
   const short c_imap_keep_alive = cs_subset_number(NeoMutt->sub, "imap_keep_alive");
 
-  if ((adata->state >= IMAP_AUTHENTICATED) && (now >= (adata->lastread + c_imap_keep_alive)))
+  if (adata->account && (adata->account->adata != adata))
+  {
+    /* An extra connection: pick up the replies to the background commands */
+    if (adata->state >= IMAP_AUTHENTICATED)
+    {
+      imap_cmd_poll(adata);
+      if (now >= (adata->lastread + c_imap_keep_alive))
+      {
+        mutt_debug(LL_DEBUG5, "imap_keep_alive\n");
+        imap_exec(adata, "NOOP", IMAP_CMD_POLL);
+      }
+    }
+  }
+  else if ((adata->state >= IMAP_AUTHENTICATED) && (now >= (adata->lastread + c_imap_keep_alive)))
   {
     mutt_debug(LL_DEBUG5, "imap_keep_alive\n");
     imap_check_mailbox(adata->mailbox, true);
   }
+  else if (adata->state >= IMAP_SELECTED)
+  {
+    /* Use the idle time to fetch the headers skipped by $imap_fetch_window,
+     * then to fill the message cache */
+    const bool idle = (adata->state == IMAP_IDLE);
+    struct Mailbox *m = adata->mailbox;
+    struct ImapMboxData *mdata = imap_mdata_get(m);
+    if (mdata && mdata->backfill)
+    {
+      if (imap_read_headers_backfill(m) > 0)
+        mdata->backfill_windows++;
+
+      /* Rebuilding the view is expensive, so only do it every few windows */
+      if ((mdata->backfill_windows > 0) &&
+          (!mdata->backfill || (mdata->backfill_windows >= IMAP_BACKFILL_REBUILD)))
+      {
+        mdata->backfill_windows = 0;
+        mdata->check_status |= IMAP_BACKFILL_PENDING;
+        m->last_checked = 0; // Let the next mailbox check pick them up
+      }
+    }
+    else
+    {
+      imap_prefetch(m);
+    }
+
+    if (idle && (adata->state != IMAP_IDLE))
+      imap_cmd_idle(adata);
+  }
 
   mutt_debug(LL_DEBUG5, "imap timeout done\n");
   return 0;
@@ -75,6 +118,13 @@ void imap_adata_free(void **ptr)
 
   notify_observer_remove(NeoMutt->notify_timeout, imap_timeout_observer, adata);
 
+  struct ImapAccountData **sp = NULL;
+  ARRAY_FOREACH(sp, &adata->pool)
+  {
+    imap_adata_free((void **) sp);
+  }
+  ARRAY_FREE(&adata->pool);
+
   FREE(&adata->capstr);
   buf_dealloc(&adata->cmdbuf);
   FREE(&adata->buf);
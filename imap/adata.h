@@ -31,6 +31,8 @@
 struct Account;
 struct Mailbox;
 
+ARRAY_HEAD(ImapAccountDataArray, struct ImapAccountData *);
+
 /**
  * struct ImapAccountData - IMAP-specific Account data - @extends Account
  *
@@ -76,6 +78,11 @@ struct ImapAccountData
   struct Mailbox *mailbox;      ///< Current selected mailbox
   struct Mailbox *prev_mailbox; ///< Previously selected mailbox
   struct Account *account;      ///< Parent Account
+
+  struct ImapAccountDataArray pool; ///< Extra connections for background work, e.g. STATUS
+  size_t pool_next;                 ///< Next connection in the pool to use
+  time_t pool_retry;                ///< Don't try to log in an extra connection before this time
+  int pool_failures;                ///< Number of failed logins of extra connections in a row
 };
 
 void                    imap_adata_free(void **ptr);
@@ -161,6 +161,7 @@ static int browse_add_list_result(struct ImapAccountData *adata, const char *cmd
   if (!url)
     return -1;
 
+  imap_cmd_flush(adata);
   imap_cmd_start(adata, cmd);
   adata->cmdresult = &list;
   do
@@ -273,6 +274,7 @@ int imap_browse(const char *path, struct BrowserState *state)
     len = snprintf(buf, sizeof(buf), "%s \"\" %s", list_cmd, munged_mbox);
     if (adata->capabilities & IMAP_CAP_LIST_EXTENDED)
       snprintf(buf + len, sizeof(buf) - len, " RETURN (CHILDREN)");
+    imap_cmd_flush(adata);
     imap_cmd_start(adata, buf);
     adata->cmdresult = &list;
     do
@@ -86,6 +86,9 @@ static const char *const Capabilities[] = {
   "COMPRESS=DEFLATE",
   "X-GM-EXT-1",
   "ID",
+  "LIST-STATUS",
+  "NOTIFY",
+  "ESEARCH",
   NULL,
 };
 
@@ -292,6 +295,10 @@ static void cmd_parse_expunge(struct ImapAccountData *adata, const char *s)
   }
   imap_msn_shrink(&mdata->msn, 1);
 
+  /* keep the $imap_prefetch scan in the same place */
+  if ((exp_msn - 1) < mdata->prefetch_scan)
+    mdata->prefetch_scan--;
+
   mdata->reopen |= IMAP_EXPUNGE_PENDING;
 }
 
@@ -377,6 +384,9 @@ static void cmd_parse_vanished(struct ImapAccountData *adata, char *s)
       }
 
       imap_msn_shrink(&mdata->msn, 1);
+
+      if ((exp_msn - 1) < mdata->prefetch_scan)
+        mdata->prefetch_scan--;
     }
   }
 
@@ -851,6 +861,8 @@ static void cmd_parse_status(struct ImapAccountData *adata, char *s)
   }
   uint32_t olduv = mdata->uidvalidity;
   unsigned int oldun = mdata->uid_next;
+  bool got_unseen = false;
+  mdata->status_queued = NULL;
 
   if (*s++ != '(')
   {
@@ -897,7 +909,10 @@ static void cmd_parse_status(struct ImapAccountData *adata, char *s)
         else if (mutt_str_startswith(s, "UIDNEXT"))
           mdata->uid_next = count;
         else if (mutt_str_startswith(s, "UNSEEN"))
+        {
           mdata->unseen = count;
+          got_unseen = true;
+        }
       }
     }
 
@@ -905,6 +920,10 @@ static void cmd_parse_status(struct ImapAccountData *adata, char *s)
     if ((s[0] != '\0') && (*s != ')'))
       s = imap_next_word(s);
   }
+  /* Our own STATUS commands always ask for UNSEEN, but the updates pushed by
+   * NOTIFY may leave it out.  If so, the unread count needs refreshing. */
+  mdata->notify_stale = !got_unseen;
+
   mutt_debug(LL_DEBUG3, "%s (UIDVALIDITY: %u, UIDNEXT: %u) %d messages, %d recent, %d unseen\n",
              mdata->name, mdata->uidvalidity, mdata->uid_next, mdata->messages,
              mdata->recent, mdata->unseen);
@@ -1067,6 +1086,10 @@ static int cmd_handle_untagged(struct ImapAccountData *adata)
   {
     cmd_parse_search(adata, s);
   }
+  else if (mutt_istr_startswith(s, "ESEARCH"))
+  {
+    cmd_parse_esearch(adata, s);
+  }
   else if (mutt_istr_startswith(s, "STATUS"))
   {
     cmd_parse_status(adata, s);
@@ -1075,6 +1098,12 @@ static int cmd_handle_untagged(struct ImapAccountData *adata)
   {
     cmd_parse_enabled(adata, s);
   }
+  else if (mutt_istr_startswith(s, "OK [NOTIFICATIONOVERFLOW"))
+  {
+    /* The server has given up on NOTIFY, go back to polling */
+    mutt_debug(LL_DEBUG2, "Handling NOTIFICATIONOVERFLOW\n");
+    imap_notify_reset(adata);
+  }
   else if (mutt_istr_startswith(s, "BYE"))
   {
     mutt_debug(LL_DEBUG2, "Handling BYE\n");
@@ -1240,6 +1269,7 @@ int imap_cmd_step(struct ImapAccountData *adata)
   else
   {
     mutt_debug(LL_DEBUG3, "IMAP queue drained\n");
+    imap_list_status_reset(adata);
     imap_cmd_finish(adata);
   }
 
@@ -1355,6 +1385,69 @@ int imap_exec(struct ImapAccountData *adata, const char *cmdstr, ImapCmdFlags fl
   return IMAP_EXEC_SUCCESS;
 }
 
+/**
+ * imap_cmd_flush - Send any queued commands and wait for all outstanding responses
+ * @param adata Imap Account data
+ * @retval #IMAP_EXEC_SUCCESS Nothing was outstanding, or all commands succeeded
+ * @retval #IMAP_EXEC_ERROR   A command returned an error
+ * @retval #IMAP_EXEC_FATAL   Imap connection failure
+ *
+ * Call this before collecting results through adata->cmdresult, so that the
+ * responses to queued commands, e.g. LIST-STATUS, don't get mixed in.
+ */
+int imap_cmd_flush(struct ImapAccountData *adata)
+{
+  if (!adata || (adata->nextcmd == adata->lastcmd))
+    return IMAP_EXEC_SUCCESS;
+
+  if (!buf_is_empty(&adata->cmdbuf))
+    return imap_exec(adata, NULL, IMAP_CMD_POLL);
+
+  /* The commands have already been sent, e.g. LIST-STATUS,
+   * so just wait for the rest of their responses */
+  int rc;
+  mutt_sig_allow_interrupt(true);
+  do
+  {
+    rc = imap_cmd_step(adata);
+  } while (rc == IMAP_RES_CONTINUE);
+  mutt_sig_allow_interrupt(false);
+
+  if (rc == IMAP_RES_OK)
+    return IMAP_EXEC_SUCCESS;
+  if (adata->status == IMAP_FATAL)
+    return IMAP_EXEC_FATAL;
+  return IMAP_EXEC_ERROR;
+}
+
+/**
+ * imap_cmd_poll - Handle any responses the server has already sent
+ * @param adata Imap Account data
+ * @retval  0 Success
+ * @retval -1 Error
+ *
+ * Unlike imap_exec(), this doesn't wait for the server, so it's used to pick
+ * up the replies to commands that were sent in the background, or updates
+ * pushed by the server, e.g. with NOTIFY.
+ */
+int imap_cmd_poll(struct ImapAccountData *adata)
+{
+  if (!adata || !adata->conn)
+    return -1;
+
+  int rc;
+  while ((rc = mutt_socket_poll(adata->conn, 0)) > 0)
+  {
+    if (imap_cmd_step(adata) < 0)
+    {
+      mutt_debug(LL_DEBUG1, "Error reading server response\n");
+      return -1;
+    }
+  }
+
+  return (rc < 0) ? -1 : 0;
+}
+
 /**
  * imap_cmd_finish - Attempt to perform cleanup
  * @param adata Imap Account data
@@ -78,12 +78,18 @@ static struct ConfigDef ImapVars[] = {
   { "imap_authenticators", DT_SLIST|D_SLIST_SEP_COLON, 0, 0, imap_auth_validator,
     "(imap) List of allowed IMAP authentication methods (colon-separated)"
   },
+  { "imap_connections", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 1, 0, NULL,
+    "(imap) Number of connections to open to each IMAP account"
+  },
   { "imap_delim_chars", DT_STRING, IP "/.", 0, NULL,
     "(imap) Characters that denote separators in IMAP folders"
   },
   { "imap_fetch_chunk_size", DT_LONG|D_INTEGER_NOT_NEGATIVE, 0, 0, NULL,
     "(imap) Download headers in blocks of this size"
   },
+  { "imap_fetch_window", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 0, 0, NULL,
+    "(imap) Only download this many headers when opening a mailbox"
+  },
   { "imap_headers", DT_STRING, 0, 0, NULL,
     "(imap) Additional email headers to download when getting index"
   },
@@ -93,6 +99,9 @@ static struct ConfigDef ImapVars[] = {
   { "imap_login", DT_STRING|D_SENSITIVE, 0, 0, NULL,
     "(imap) Login name for the IMAP server (defaults to `$imap_user`)"
   },
+  { "imap_notify", DT_BOOL, false, 0, NULL,
+    "(imap) Use NOTIFY to have the server push mailbox updates"
+  },
   { "imap_oauth_refresh_command", DT_STRING|D_STRING_COMMAND|D_SENSITIVE, 0, 0, NULL,
     "(imap) External command to generate OAUTH refresh token"
   },
@@ -111,6 +120,9 @@ static struct ConfigDef ImapVars[] = {
   { "imap_keep_alive", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 300, 0, NULL,
     "(imap) Time to wait before polling an open IMAP connection"
   },
+  { "imap_list_status", DT_BOOL, true, 0, NULL,
+    "(imap) Use LIST-STATUS to check the stats of all mailboxes at once"
+  },
   { "imap_list_subscribed", DT_BOOL, false, 0, NULL,
     "(imap) When browsing a mailbox, only display subscribed folders"
   },
@@ -123,6 +135,12 @@ static struct ConfigDef ImapVars[] = {
   { "imap_poll_timeout", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 15, 0, NULL,
     "(imap) Maximum time to wait for a server response"
   },
+  { "imap_prefetch", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 0, 0, NULL,
+    "(imap) Number of emails to download into the message cache while idle"
+  },
+  { "imap_prefetch_limit", DT_LONG|D_INTEGER_NOT_NEGATIVE, 262144, 0, NULL,
+    "(imap) Maximum number of bytes to prefetch each second"
+  },
   { "imap_qresync", DT_BOOL, false, 0, NULL,
     "(imap) Enable the QRESYNC extension"
   },
@@ -566,6 +566,13 @@ void imap_logout_all(void)
     if (!adata)
       continue;
 
+    struct ImapAccountData **pp = NULL;
+    ARRAY_FOREACH(pp, &adata->pool)
+    {
+      if ((*pp)->conn && ((*pp)->conn->fd >= 0))
+        imap_logout(*pp);
+    }
+
     struct Connection *conn = adata->conn;
     if (!conn || (conn->fd < 0))
       continue;
@@ -861,6 +868,8 @@ void imap_close_connection(struct ImapAccountData *adata)
   adata->lastcmd = 0;
   adata->status = 0;
   memset(adata->cmds, 0, sizeof(struct ImapCommand) * adata->cmdslots);
+  imap_list_status_reset(adata);
+  imap_notify_reset(adata);
 }
 
 /**
@@ -1083,11 +1092,25 @@ enum MxStatus imap_check_mailbox(struct Mailbox *m, bool force)
 
   enum MxStatus check = MX_STATUS_OK;
   if (mdata->check_status & IMAP_EXPUNGE_PENDING)
+  {
     check = MX_STATUS_REOPENED;
+  }
   else if (mdata->check_status & IMAP_NEWMAIL_PENDING)
+  {
     check = MX_STATUS_NEW_MAIL;
+  }
   else if (mdata->check_status & IMAP_FLAGS_PENDING)
+  {
+    /* The view must include any old headers fetched in the background */
+    if (mdata->check_status & IMAP_BACKFILL_PENDING)
+      mailbox_changed(m, NT_MAILBOX_INVALID);
     check = MX_STATUS_FLAGS;
+  }
+  else if (mdata->check_status & IMAP_BACKFILL_PENDING)
+  {
+    /* Old headers fetched in the background aren't new mail */
+    check = MX_STATUS_BACKFILL;
+  }
   else if (rc < 0)
     check = MX_STATUS_ERROR;
 
@@ -1098,6 +1121,287 @@ enum MxStatus imap_check_mailbox(struct Mailbox *m, bool force)
   return check;
 }
 
+/**
+ * imap_list_status_reset - Forget about any LIST-STATUS commands in flight
+ * @param adata Imap Account data
+ *
+ * Called when the command queue drains, or the connection is dropped, so that
+ * Mailboxes the server didn't report on will be polled again.  Only the
+ * commands sent on this connection are forgotten.
+ */
+void imap_list_status_reset(struct ImapAccountData *adata)
+{
+  if (!adata || !adata->account)
+    return;
+
+  struct MailboxNode *np = NULL;
+  STAILQ_FOREACH(np, &adata->account->mailboxes, entries)
+  {
+    struct ImapMboxData *mdata = imap_mdata_get(np->mailbox);
+    if (mdata && (mdata->status_queued == adata))
+      mdata->status_queued = NULL;
+  }
+}
+
+/**
+ * list_status_send - Queue a LIST-STATUS command
+ * @param adata Imap Account data
+ * @param cmd   Command, listing the Mailboxes, without the RETURN options
+ * @retval num Result, e.g. #IMAP_EXEC_SUCCESS
+ */
+static int list_status_send(struct ImapAccountData *adata, struct Buffer *cmd)
+{
+  buf_addstr(cmd, ") RETURN (STATUS (UIDNEXT UIDVALIDITY UNSEEN RECENT MESSAGES))");
+  int rc = imap_exec(adata, buf_string(cmd), IMAP_CMD_QUEUE);
+  buf_reset(cmd);
+  return rc;
+}
+
+/**
+ * imap_list_status - Refresh the statistics of all the polled Mailboxes
+ * @param adata Imap Account data
+ * @param mdata Imap Mailbox data of the Mailbox being checked
+ * @retval num Result, e.g. #IMAP_EXEC_SUCCESS
+ *
+ * Rather than sending one STATUS command per Mailbox, ask for the statistics
+ * of every polled Mailbox in the Account using LIST-STATUS (RFC5819).
+ * The server replies with a STATUS response for each Mailbox, which is handled
+ * by cmd_parse_status().
+ *
+ * Mailboxes that are already covered by a queued LIST-STATUS are skipped.
+ */
+static int imap_list_status(struct ImapAccountData *adata, struct ImapMboxData *mdata)
+{
+  /* Keep the command lines to a size that all servers will accept */
+  const size_t max_len = 4096;
+  /* adata may be an extra connection; the main one knows the selected mailbox */
+  struct ImapAccountData *adata_main = adata->account->adata;
+  struct Buffer *cmd = buf_pool_get();
+  int rc = IMAP_EXEC_SUCCESS;
+
+  struct MailboxNode *np = NULL;
+  STAILQ_FOREACH(np, &adata->account->mailboxes, entries)
+  {
+    struct Mailbox *m = np->mailbox;
+    struct ImapMboxData *mdata_poll = imap_mdata_get(m);
+    if (!mdata_poll || mdata_poll->status_queued)
+      continue;
+
+    if ((mdata_poll != mdata) && (!m->visible || !m->poll_new_mail))
+      continue;
+
+    /* The selected mailbox will be NOOPed or IDLEd elsewhere */
+    if (adata_main->mailbox && (adata_main->mailbox->mdata == mdata_poll))
+      continue;
+
+    buf_addstr(cmd, buf_is_empty(cmd) ? "LIST \"\" (" : " ");
+    buf_addstr(cmd, mdata_poll->munge_name);
+    mdata_poll->status_queued = adata;
+
+    if (buf_len(cmd) > max_len)
+    {
+      rc = list_status_send(adata, cmd);
+      if (rc != IMAP_EXEC_SUCCESS)
+        break;
+    }
+  }
+
+  if ((rc == IMAP_EXEC_SUCCESS) && !buf_is_empty(cmd))
+    rc = list_status_send(adata, cmd);
+
+  buf_pool_release(&cmd);
+  return rc;
+}
+
+/**
+ * imap_notify_reset - Forget which Mailboxes are covered by NOTIFY
+ * @param adata Imap Account data
+ *
+ * Called when the connection is dropped, or the server abandons NOTIFY, so
+ * that the next check will set it up again.
+ */
+void imap_notify_reset(struct ImapAccountData *adata)
+{
+  /* NOTIFY is only used on the main connection, not the extra ones */
+  if (!adata || !adata->account || (adata->account->adata != adata))
+    return;
+
+  struct MailboxNode *np = NULL;
+  STAILQ_FOREACH(np, &adata->account->mailboxes, entries)
+  {
+    struct ImapMboxData *mdata = imap_mdata_get(np->mailbox);
+    if (mdata)
+      mdata->notify = false;
+  }
+}
+
+/**
+ * imap_notify_set - Ask the server to push updates for all the polled Mailboxes
+ * @param adata Imap Account data
+ * @param mdata Imap Mailbox data of the Mailbox being checked
+ * @retval  0 Success
+ * @retval -1 Error
+ *
+ * Use NOTIFY (RFC5465) to register for MessageNew, MessageExpunge and
+ * FlagChange events on every polled Mailbox of the Account.  The server will
+ * send STATUS responses for them, even when they aren't selected, which are
+ * handled by cmd_parse_status().  The STATUS option requests the initial
+ * counts.
+ *
+ * NOTIFY can't choose which STATUS items are sent.  If an update lacks UNSEEN,
+ * imap_mailbox_status() follows it up with an explicit STATUS.
+ *
+ * A NOTIFY SET replaces the previous one, so this is sent again whenever a new
+ * Mailbox needs to be watched.
+ */
+static int imap_notify_set(struct ImapAccountData *adata, struct ImapMboxData *mdata)
+{
+  struct Buffer *cmd = buf_pool_get();
+  struct Buffer *names = buf_pool_get();
+  int rc = -1;
+
+  struct MailboxNode *np = NULL;
+  STAILQ_FOREACH(np, &adata->account->mailboxes, entries)
+  {
+    struct Mailbox *m = np->mailbox;
+    struct ImapMboxData *mdata_poll = imap_mdata_get(m);
+    if (!mdata_poll)
+      continue;
+
+    if ((mdata_poll != mdata) && (!m->visible || !m->poll_new_mail))
+      continue;
+
+    if (!buf_is_empty(names))
+      buf_addch(names, ' ');
+    buf_addstr(names, mdata_poll->munge_name);
+  }
+
+  if (buf_is_empty(names))
+    goto done;
+
+  buf_printf(cmd, "NOTIFY SET STATUS (selected-delayed (MessageNew MessageExpunge FlagChange)) "
+                  "(mailboxes (%s) (MessageNew MessageExpunge FlagChange))",
+             buf_string(names));
+
+  if (imap_exec(adata, buf_string(cmd), IMAP_CMD_POLL) != IMAP_EXEC_SUCCESS)
+  {
+    mutt_debug(LL_DEBUG1, "NOTIFY failed, disabling it\n");
+    adata->capabilities &= ~IMAP_CAP_NOTIFY; // Clear the flag
+    goto done;
+  }
+
+  STAILQ_FOREACH(np, &adata->account->mailboxes, entries)
+  {
+    struct Mailbox *m = np->mailbox;
+    struct ImapMboxData *mdata_poll = imap_mdata_get(m);
+    if (mdata_poll && ((mdata_poll == mdata) || (m->visible && m->poll_new_mail)))
+      mdata_poll->notify = true;
+  }
+  rc = 0;
+
+done:
+  buf_pool_release(&cmd);
+  buf_pool_release(&names);
+  return rc;
+}
+
+/**
+ * pool_backoff - Delay the next login of an extra connection
+ * @param adata Imap Account data of the main connection
+ *
+ * Each failure in a row doubles the delay, from one minute up to an hour.
+ */
+static void pool_backoff(struct ImapAccountData *adata)
+{
+  const int delay = 60 << MIN(adata->pool_failures, 6);
+  adata->pool_failures++;
+  adata->pool_retry = mutt_date_now() + MIN(delay, 3600);
+  mutt_debug(LL_DEBUG1, "Not opening extra connections for %d seconds\n", MIN(delay, 3600));
+}
+
+/**
+ * imap_pool_get - Get a connection for background work
+ * @param adata Imap Account data
+ * @retval ptr Connection to use
+ *
+ * If $imap_connections is greater than 1, the Account keeps some extra
+ * authenticated connections, which are used in turn for background work, such
+ * as STATUS polling.  This leaves the main connection free for the selected
+ * Mailbox.  The extra connections are opened when they're first needed.
+ *
+ * If an extra connection can't be used, the main one is returned.
+ */
+struct ImapAccountData *imap_pool_get(struct ImapAccountData *adata)
+{
+  if (!adata || !adata->account || !adata->conn)
+    return adata;
+
+  const short c_imap_connections = cs_subset_number(NeoMutt->sub, "imap_connections");
+  if (c_imap_connections < 2)
+    return adata;
+
+  /* After a failed login, e.g. the server limits the number of connections,
+   * make do with what we've got for a while */
+  const bool can_login = (mutt_date_now() >= adata->pool_retry);
+
+  struct ImapAccountData *pdata = NULL;
+  if (can_login && (ARRAY_SIZE(&adata->pool) < (size_t) (c_imap_connections - 1)))
+  {
+    pdata = imap_adata_new(adata->account);
+    pdata->conn = mutt_conn_new(&adata->conn->account);
+    if (!pdata->conn || (imap_login(pdata) < 0))
+    {
+      mutt_debug(LL_DEBUG1, "Can't open an extra connection to %s\n",
+                 adata->conn->account.host);
+      imap_adata_free((void **) &pdata);
+      pool_backoff(adata);
+    }
+    else
+    {
+      adata->pool_failures = 0;
+      ARRAY_ADD(&adata->pool, pdata);
+      return pdata;
+    }
+  }
+
+  if (ARRAY_EMPTY(&adata->pool))
+    return adata;
+
+  struct ImapAccountData **pp = ARRAY_GET(&adata->pool, adata->pool_next++ % ARRAY_SIZE(&adata->pool));
+  pdata = *pp;
+
+  if ((pdata->status == IMAP_FATAL) || (pdata->state < IMAP_AUTHENTICATED))
+  {
+    if (mutt_date_now() < adata->pool_retry)
+      return adata;
+
+    imap_close_connection(pdata);
+    if (imap_login(pdata) < 0)
+    {
+      pool_backoff(adata);
+      return adata;
+    }
+    adata->pool_failures = 0;
+  }
+
+  return pdata;
+}
+
+/**
+ * pool_send - Send the commands queued on an extra connection
+ * @param adata Imap Account data of the extra connection
+ * @retval num Result, e.g. #IMAP_EXEC_SUCCESS
+ *
+ * Don't wait for the server; the replies are picked up by imap_cmd_poll().
+ */
+static int pool_send(struct ImapAccountData *adata)
+{
+  if (buf_is_empty(&adata->cmdbuf))
+    return IMAP_EXEC_SUCCESS;
+
+  return (imap_cmd_start(adata, NULL) < 0) ? IMAP_EXEC_FATAL : IMAP_EXEC_SUCCESS;
+}
+
 /**
  * imap_status - Refresh the number of total and new messages
  * @param adata  IMAP Account data
@@ -1126,11 +1430,52 @@ static int imap_status(struct ImapAccountData *adata, struct ImapMboxData *mdata
   if (adata->mailbox && !adata->mailbox->poll_new_mail)
     return mdata->messages;
 
-  if (adata->capabilities & IMAP_CAP_IMAP4REV1)
+  /* With NOTIFY, the server tells us about changes, so there's nothing to send */
+  const bool c_imap_notify = cs_subset_bool(NeoMutt->sub, "imap_notify");
+  if (c_imap_notify && (adata->capabilities & IMAP_CAP_NOTIFY) &&
+      (adata->state >= IMAP_AUTHENTICATED) &&
+      (mdata->notify || (imap_notify_set(adata, mdata) == 0)))
+  {
+    if (imap_cmd_poll(adata) < 0)
+      return -1;
+    if (!mdata->notify_stale)
+      return mdata->messages;
+
+    /* NOTIFY can't ask for particular STATUS items, so if an update didn't
+     * include UNSEEN, fall back to an explicit STATUS */
+    mdata->notify_stale = false;
+  }
+
+  /* Queued commands may be run on an extra connection, see $imap_connections.
+   * Pick up the replies to the previous round first. */
+  struct ImapAccountData *sdata = queue ? imap_pool_get(adata) : adata;
+  if ((sdata != adata) && (imap_cmd_poll(sdata) < 0))
+    return -1;
+
+  /* LIST-STATUS fetches the stats for the whole Account in one go */
+  const bool c_imap_list_status = cs_subset_bool(NeoMutt->sub, "imap_list_status");
+  if (queue && c_imap_list_status && (sdata->capabilities & IMAP_CAP_LIST_STATUS) &&
+      (sdata->capabilities & IMAP_CAP_LIST_EXTENDED))
+  {
+    if (mdata->status_queued)
+      return mdata->messages;
+
+    int rc = imap_list_status(sdata, mdata);
+    if ((rc == IMAP_EXEC_SUCCESS) && (sdata != adata))
+      rc = pool_send(sdata);
+    if (rc != IMAP_EXEC_SUCCESS)
+    {
+      mutt_debug(LL_DEBUG1, "Error queueing command\n");
+      return rc;
+    }
+    return mdata->messages;
+  }
+
+  if (sdata->capabilities & IMAP_CAP_IMAP4REV1)
   {
     uidvalidity_flag = "UIDVALIDITY";
   }
-  else if (adata->capabilities & IMAP_CAP_STATUS)
+  else if (sdata->capabilities & IMAP_CAP_STATUS)
   {
     uidvalidity_flag = "UID-VALIDITY";
   }
@@ -1143,7 +1488,9 @@ static int imap_status(struct ImapAccountData *adata, struct ImapMboxData *mdata
   snprintf(cmd, sizeof(cmd), "STATUS %s (UIDNEXT %s UNSEEN RECENT MESSAGES)",
            mdata->munge_name, uidvalidity_flag);
 
-  int rc = imap_exec(adata, cmd, queue ? IMAP_CMD_QUEUE : IMAP_CMD_POLL);
+  int rc = imap_exec(sdata, cmd, queue ? IMAP_CMD_QUEUE : IMAP_CMD_POLL);
+  if ((rc == IMAP_EXEC_SUCCESS) && (sdata != adata))
+    rc = pool_send(sdata);
   if (rc != IMAP_EXEC_SUCCESS)
   {
     mutt_debug(LL_DEBUG1, "Error queueing command\n");
@@ -1297,6 +1644,7 @@ int imap_complete(struct Buffer *buf, const char *path)
   snprintf(tmp, sizeof(tmp), "%s \"\" \"%s%%\"",
            c_imap_list_subscribed ? "LSUB" : "LIST", mdata->real_name);
 
+  imap_cmd_flush(adata);
   imap_cmd_start(adata, tmp);
 
   /* and see what the results are */
@@ -1888,6 +2236,10 @@ static enum MxOpenReturns imap_mbox_open(struct Mailbox *m)
   adata->status = 0;
   m->rights = 0;
   mdata->new_mail_count = 0;
+  mdata->prefetch_uid = 0;
+  mdata->prefetch_followed = 0;
+  mdata->prefetch_scan = 0;
+  mdata->prefetch_failed = false;
 
   if (m->verbose)
     mutt_message(_("Selecting %s..."), mdata->name);
@@ -54,11 +54,20 @@ struct ImapMboxData
   unsigned int messages;
   unsigned int recent;
   unsigned int unseen;
+  struct ImapAccountData *status_queued; ///< Connection with a LIST-STATUS covering this Mailbox in flight
+  bool notify;        ///< The server pushes STATUS updates for this Mailbox (NOTIFY)
+  bool notify_stale;  ///< A pushed STATUS lacked UNSEEN, so ask for it
 
   // Cached data used only when the mailbox is opened
   struct HashTable *uid_hash;               ///< Hash Table: "uid" -> Email
   ARRAY_HEAD(MSNArray, struct Email *) msn; ///< look up headers by (MSN-1)
+  bool backfill;                            ///< Some headers were skipped by $imap_fetch_window
+  int backfill_windows;                     ///< Number of backfilled windows not in the view yet
   struct BodyCache *bcache;                 ///< Email body cache
+  unsigned int prefetch_uid;                ///< UID of the last Email read, for $imap_prefetch
+  unsigned int prefetch_followed;           ///< prefetch_uid whose following Emails have been fetched
+  size_t prefetch_scan;                     ///< MSN-1 of the next Email to check for background prefetching
+  bool prefetch_failed;                     ///< Background prefetching failed, don't retry
 
   struct HeaderCache *hcache; ///< Email header cache
   struct timespec mtime;      ///< Time Mailbox was last changed
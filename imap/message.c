@@ -1442,7 +1442,24 @@ retry:
   }
 #endif /* USE_HCACHE */
 
-  if (read_headers_fetch_new(m, msn_begin, msn_end, evalhc, &maxuid, initial_download) < 0)
+  /* Only fetch the newest headers now, the rest will be filled in later */
+  unsigned int fetch_msn_begin = msn_begin;
+  if (initial_download)
+  {
+    mdata->backfill = false;
+    mdata->backfill_windows = 0;
+  }
+  const short c_imap_fetch_window = cs_subset_number(NeoMutt->sub, "imap_fetch_window");
+  if (initial_download && (c_imap_fetch_window > 0) &&
+      ((msn_end - msn_begin + 1) > (unsigned int) c_imap_fetch_window))
+  {
+    fetch_msn_begin = msn_end - c_imap_fetch_window + 1;
+    mdata->backfill = true;
+    mutt_debug(LL_DEBUG2, "Fetching headers %u to %u, deferring %u to %u\n",
+               fetch_msn_begin, msn_end, msn_begin, fetch_msn_begin - 1);
+  }
+
+  if (read_headers_fetch_new(m, fetch_msn_begin, msn_end, evalhc, &maxuid, initial_download) < 0)
     goto bail;
 
 #ifdef USE_HCACHE
@@ -1519,6 +1536,78 @@ bail:
   return rc;
 }
 
+/**
+ * imap_read_headers_backfill - Fetch some of the headers skipped when opening
+ * @param m Imap Selected Mailbox
+ * @retval num Number of headers fetched
+ * @retval -1  Failure
+ *
+ * When $imap_fetch_window is set, only the newest headers are fetched when the
+ * Mailbox is opened.  This fetches the next block of older headers, working
+ * down from the highest missing MSN.  It's called while the user is idle.
+ */
+int imap_read_headers_backfill(struct Mailbox *m)
+{
+  struct ImapAccountData *adata = imap_adata_get(m);
+  struct ImapMboxData *mdata = imap_mdata_get(m);
+  if (!adata || !mdata || (adata->mailbox != m) || !mdata->backfill)
+    return 0;
+
+  /* Find the highest missing MSN */
+  unsigned int msn_end = imap_msn_highest(&mdata->msn);
+  while ((msn_end > 0) && imap_msn_get(&mdata->msn, msn_end - 1))
+    msn_end--;
+
+  if (msn_end == 0)
+  {
+    mutt_debug(LL_DEBUG2, "All headers have been fetched\n");
+    mdata->backfill = false;
+    return 0;
+  }
+
+  const short c_imap_fetch_window = cs_subset_number(NeoMutt->sub, "imap_fetch_window");
+  const unsigned int window = MAX(c_imap_fetch_window, 1);
+  const unsigned int msn_begin = (msn_end > window) ? (msn_end - window + 1) : 1;
+
+  mutt_debug(LL_DEBUG2, "Backfilling headers %u to %u\n", msn_begin, msn_end);
+
+  const int old_count = m->msg_count;
+  const bool verbose = m->verbose;
+  unsigned int maxuid = 0;
+
+  /* Don't let imap_cmd_finish() reopen the mailbox while we're busy */
+  mdata->reopen &= ~IMAP_REOPEN_ALLOW;
+  m->verbose = false;
+#ifdef USE_HCACHE
+  imap_hcache_open(adata, mdata, true);
+#endif
+
+  /* The MSN array has holes, so only ask for the missing headers */
+  int rc = read_headers_fetch_new(m, msn_begin, msn_end, true, &maxuid, false);
+
+#ifdef USE_HCACHE
+  imap_hcache_close(mdata);
+#endif
+  m->verbose = verbose;
+  mdata->reopen |= IMAP_REOPEN_ALLOW;
+
+  if (rc < 0)
+    return -1;
+
+  /* Let $imap_prefetch look at the new headers */
+  mdata->prefetch_scan = MIN(mdata->prefetch_scan, msn_begin - 1);
+
+  /* Working down, so this was the last window */
+  if (msn_begin == 1)
+  {
+    mutt_debug(LL_DEBUG2, "All headers have been fetched\n");
+    mdata->backfill = false;
+  }
+
+  mx_alloc_memory(m, m->msg_count);
+  return m->msg_count - old_count;
+}
+
 /**
  * imap_append_message - Write an email back to the server
  * @param m   Mailbox
@@ -1899,6 +1988,223 @@ int imap_cache_clean(struct Mailbox *m)
   return 0;
 }
 
+/**
+ * prefetch_fetch - Download an email's body into the message cache
+ * @param m Selected Imap Mailbox
+ * @param e Email
+ * @retval  0 Success
+ * @retval -1 Failure
+ *
+ * The body is fetched with BODY.PEEK[] so that the email isn't marked as read.
+ */
+static int prefetch_fetch(struct Mailbox *m, struct Email *e)
+{
+  struct ImapAccountData *adata = imap_adata_get(m);
+  struct ImapEmailData *edata = imap_edata_get(e);
+  char buf[64] = { 0 };
+  unsigned int msn = 0;
+  unsigned int bytes = 0;
+  bool fetched = false;
+  int rc;
+
+  FILE *fp = msg_cache_put(m, e);
+  if (!fp)
+    return -1;
+
+  /* see imap_msg_open() */
+  e->active = false;
+
+  snprintf(buf, sizeof(buf), "UID FETCH %u BODY.PEEK[]", edata->uid);
+  imap_cmd_start(adata, buf);
+  do
+  {
+    rc = imap_cmd_step(adata);
+    if (rc != IMAP_RES_CONTINUE)
+      break;
+
+    char *pc = imap_next_word(adata->buf);
+    if (!mutt_str_atoui(pc, &msn) || (msn != edata->msn))
+      continue;
+    pc = imap_next_word(pc);
+    if (!mutt_istr_startswith(pc, "FETCH"))
+      continue;
+
+    while (*pc)
+    {
+      pc = imap_next_word(pc);
+      if (pc[0] == '(')
+        pc++;
+      if (mutt_istr_startswith(pc, "BODY[]"))
+      {
+        pc = imap_next_word(pc);
+        if ((imap_get_literal_count(pc, &bytes) < 0) ||
+            (imap_read_literal(fp, adata, bytes, NULL) < 0))
+        {
+          goto bail;
+        }
+        /* pick up trailing line */
+        rc = imap_cmd_step(adata);
+        if (rc != IMAP_RES_CONTINUE)
+          goto bail;
+        pc = adata->buf;
+
+        fetched = true;
+      }
+      else if (!e->changed && mutt_istr_startswith(pc, "FLAGS"))
+      {
+        pc = imap_set_flags(m, e, pc, NULL);
+        if (!pc)
+          goto bail;
+      }
+    }
+  } while (rc == IMAP_RES_CONTINUE);
+
+  e->active = true;
+
+  if ((mutt_file_fclose(&fp) != 0) || (rc != IMAP_RES_OK) || !fetched ||
+      !imap_code(adata->buf))
+  {
+    goto bail;
+  }
+
+  return msg_cache_commit(m, e);
+
+bail:
+  e->active = true;
+  mutt_file_fclose(&fp);
+  imap_cache_del(m, e);
+  return -1;
+}
+
+/**
+ * prefetch_email - Prefetch an email, if it's worth it
+ * @param[in]     m      Selected Imap Mailbox
+ * @param[in]     e      Email
+ * @param[in]     limit  Maximum size of an email to prefetch, 0 for no limit
+ * @param[in,out] budget Bytes left to download in this run
+ * @retval  1 Email was downloaded
+ * @retval  0 Email was skipped, e.g. it's already cached
+ * @retval -1 Download failed
+ * @retval -2 Email doesn't fit in the remaining budget
+ */
+static int prefetch_email(struct Mailbox *m, struct Email *e, long limit, long *budget)
+{
+  if (!e || !e->active || e->deleted || !e->body)
+    return 0;
+
+  if ((limit > 0) && (e->body->length > limit))
+    return 0;
+
+  struct ImapMboxData *mdata = imap_mdata_get(m);
+  char id[64] = { 0 };
+  snprintf(id, sizeof(id), "%u-%u", mdata->uidvalidity, imap_edata_get(e)->uid);
+  if (mutt_bcache_exists(mdata->bcache, id) == 0)
+    return 0;
+
+  /* With no limit, download one email per run */
+  if ((limit > 0) ? (e->body->length > *budget) : (*budget < 0))
+    return -2;
+
+  mutt_debug(LL_DEBUG3, "prefetching uid %u (%ld bytes)\n",
+             imap_edata_get(e)->uid, (long) e->body->length);
+  if (prefetch_fetch(m, e) < 0)
+    return -1;
+
+  *budget -= (limit > 0) ? e->body->length : 1;
+  return 1;
+}
+
+/**
+ * imap_prefetch - Download email bodies into the message cache in the background
+ * @param m Selected Imap Mailbox
+ * @retval num Number of emails downloaded
+ * @retval -1  Error
+ *
+ * This is called while the user is idle.  First, the `$imap_prefetch` emails
+ * following the one last read are downloaded, then any unread emails.
+ * Each call fetches at most `$imap_prefetch_limit` bytes.
+ */
+int imap_prefetch(struct Mailbox *m)
+{
+  const short c_imap_prefetch = cs_subset_number(NeoMutt->sub, "imap_prefetch");
+  if (c_imap_prefetch <= 0)
+    return 0;
+
+  struct ImapAccountData *adata = imap_adata_get(m);
+  struct ImapMboxData *mdata = imap_mdata_get(m);
+  if (!adata || !mdata || (adata->mailbox != m) || (adata->state < IMAP_SELECTED))
+    return 0;
+
+  if (mdata->prefetch_failed)
+    return 0;
+
+  /* Nothing to do until the user reads another Email, or new mail arrives */
+  const size_t max_msn = imap_msn_highest(&mdata->msn);
+  if ((mdata->prefetch_followed == mdata->prefetch_uid) && (mdata->prefetch_scan >= max_msn))
+    return 0;
+
+  /* Leave IDLE, the caller enters it again afterwards */
+  if ((adata->state == IMAP_IDLE) && (imap_cmd_flush(adata) != IMAP_EXEC_SUCCESS))
+    return 0;
+
+  /* Don't interfere with queued commands, or an expunge that hasn't been
+   * processed yet */
+  if ((adata->nextcmd != adata->lastcmd) || (mdata->check_status & IMAP_EXPUNGE_PENDING))
+    return 0;
+
+  if (!(adata->capabilities & IMAP_CAP_IMAP4REV1))
+    return 0;
+
+  mdata->bcache = imap_bcache_open(m);
+  if (!mdata->bcache)
+    return 0;
+
+  const long c_imap_prefetch_limit = cs_subset_long(NeoMutt->sub, "imap_prefetch_limit");
+  long budget = c_imap_prefetch_limit;
+  int count = 0;
+  int rc = 0;
+
+  /* The emails following the one the user last read */
+  struct Email *e = NULL;
+  if (mdata->prefetch_uid != 0)
+    e = mutt_hash_int_find(mdata->uid_hash, mdata->prefetch_uid);
+  if (e && e->visible && (e->vnum >= 0))
+  {
+    for (int i = 1; (i <= c_imap_prefetch) && ((e->vnum + i) < m->vcount); i++)
+    {
+      rc = prefetch_email(m, m->emails[m->v2r[e->vnum + i]], c_imap_prefetch_limit, &budget);
+      if (rc < 0)
+        goto done;
+      count += rc;
+    }
+  }
+  mdata->prefetch_followed = mdata->prefetch_uid;
+
+  /* Then, any unread emails, in MSN order.  Expunges and backfilled headers
+   * move the scan position, see cmd_parse_expunge(). */
+  for (; mdata->prefetch_scan < max_msn; mdata->prefetch_scan++)
+  {
+    e = imap_msn_get(&mdata->msn, mdata->prefetch_scan);
+    if (!e || e->read)
+      continue;
+
+    rc = prefetch_email(m, e, c_imap_prefetch_limit, &budget);
+    if (rc < 0)
+      goto done;
+    count += rc;
+  }
+
+done:
+  if (rc == -1)
+  {
+    mutt_debug(LL_DEBUG1, "prefetching failed, giving up\n");
+    mdata->prefetch_failed = true;
+    return -1;
+  }
+
+  return count;
+}
+
 /**
  * imap_set_flags - Fill the message header according to the server flags
  * @param[in]  m              Imap Selected Mailbox
@@ -1990,10 +2296,14 @@ bool imap_msg_open(struct Mailbox *m, struct Message *msg, struct Email *e)
   bool fetched = false;
 
   struct ImapAccountData *adata = imap_adata_get(m);
+  struct ImapMboxData *mdata = imap_mdata_get(m);
 
   if (!adata || (adata->mailbox != m))
     return false;
 
+  /* remember where the user is reading, for $imap_prefetch */
+  mdata->prefetch_uid = imap_edata_get(e)->uid;
+
   msg->fp = msg_cache_get(m, e);
   if (msg->fp)
   {
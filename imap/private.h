@@ -66,6 +66,10 @@ typedef uint8_t ImapOpenFlags;         ///< Flags, e.g. #MUTT_THREAD_COLLAPSE
 #define IMAP_EXPUNGE_PENDING  (1 << 2) ///< Messages on the server have been expunged
 #define IMAP_NEWMAIL_PENDING  (1 << 3) ///< New mail is waiting on the server
 #define IMAP_FLAGS_PENDING    (1 << 4) ///< Flags have changed on the server
+#define IMAP_BACKFILL_PENDING (1 << 5) ///< Skipped headers have been fetched, see $imap_fetch_window
+
+/// Number of backfilled windows to fetch before rebuilding the view
+#define IMAP_BACKFILL_REBUILD 10
 
 typedef uint8_t ImapCmdFlags;          ///< Flags for imap_exec(), e.g. #IMAP_CMD_PASS
 #define IMAP_CMD_NO_FLAGS          0   ///< No flags are set
@@ -139,8 +143,11 @@ typedef uint32_t ImapCapFlags;              ///< Flags, e.g. #IMAP_CAP_IMAP4
 #define IMAP_CAP_COMPRESS         (1 << 18) ///< RFC4978: COMPRESS=DEFLATE
 #define IMAP_CAP_X_GM_EXT_1       (1 << 19) ///< https://developers.google.com/gmail/imap/imap-extensions
 #define IMAP_CAP_ID               (1 << 20) ///< RFC2971: IMAP4 ID extension
+#define IMAP_CAP_LIST_STATUS      (1 << 21) ///< RFC5819: LIST-STATUS
+#define IMAP_CAP_NOTIFY           (1 << 22) ///< RFC5465: NOTIFY
+#define IMAP_CAP_ESEARCH          (1 << 23) ///< RFC4731: ESEARCH
 
-#define IMAP_CAP_ALL             ((1 << 21) - 1)
+#define IMAP_CAP_ALL             ((1 << 24) - 1)
 
 /**
  * struct ImapList - Items in an IMAP browser
@@ -189,6 +196,9 @@ int imap_login(struct ImapAccountData *adata);
 int imap_sync_message_for_copy(struct Mailbox *m, struct Email *e, struct Buffer *cmd, enum QuadOption *err_continue);
 bool imap_has_flag(struct ListHead *flag_list, const char *flag);
 int imap_adata_find(const char *path, struct ImapAccountData **adata, struct ImapMboxData **mdata);
+void imap_list_status_reset(struct ImapAccountData *adata);
+void imap_notify_reset(struct ImapAccountData *adata);
+struct ImapAccountData *imap_pool_get(struct ImapAccountData *adata);
 
 /* auth.c */
 int imap_authenticate(struct ImapAccountData *adata);
@@ -200,13 +210,17 @@ void imap_cmd_finish(struct ImapAccountData *adata);
 bool imap_code(const char *s);
 const char *imap_cmd_trailer(struct ImapAccountData *adata);
 int imap_exec(struct ImapAccountData *adata, const char *cmdstr, ImapCmdFlags flags);
+int imap_cmd_flush(struct ImapAccountData *adata);
+int imap_cmd_poll(struct ImapAccountData *adata);
 int imap_cmd_idle(struct ImapAccountData *adata);
 
 /* message.c */
 int imap_read_headers(struct Mailbox *m, unsigned int msn_begin, unsigned int msn_end, bool initial_download);
+int imap_read_headers_backfill(struct Mailbox *m);
 char *imap_set_flags(struct Mailbox *m, struct Email *e, char *s, bool *server_changes);
 int imap_cache_del(struct Mailbox *m, struct Email *e);
 int imap_cache_clean(struct Mailbox *m);
+int imap_prefetch(struct Mailbox *m);
 int imap_append_message(struct Mailbox *m, struct Message *msg);
 
 bool imap_msg_open(struct Mailbox *m, struct Message *msg, struct Email *e);
@@ -256,5 +270,6 @@ void imap_disallow_reopen(struct Mailbox *m);
 
 /* search.c */
 void cmd_parse_search(struct ImapAccountData *adata, const char *s);
+void cmd_parse_esearch(struct ImapAccountData *adata, const char *s);
 
 #endif /* MUTT_IMAP_PRIVATE_H */
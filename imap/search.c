@@ -237,10 +237,15 @@ bool imap_search(struct Mailbox *m, const struct PatternList *pat)
   if (check_pattern_list(pat) == 0)
     return true;
 
+  struct ImapAccountData *adata = imap_adata_get(m);
+
+  /* ESEARCH returns the matches as a compact sequence set */
   struct Buffer *buf = buf_pool_get();
-  buf_addstr(buf, "UID SEARCH ");
+  if (adata->capabilities & IMAP_CAP_ESEARCH)
+    buf_addstr(buf, "UID SEARCH RETURN (ALL) ");
+  else
+    buf_addstr(buf, "UID SEARCH ");
 
-  struct ImapAccountData *adata = imap_adata_get(m);
   const bool ok = compile_search(adata, SLIST_FIRST(pat), buf) &&
                   (imap_exec(adata, buf_string(buf), IMAP_CMD_NO_FLAGS) == IMAP_EXEC_SUCCESS);
 
@@ -270,3 +275,58 @@ void cmd_parse_search(struct ImapAccountData *adata, const char *s)
       e->matched = true;
   }
 }
+
+/**
+ * cmd_parse_esearch - Store ESEARCH response for later use
+ * @param adata Imap Account data
+ * @param s     Command string with search results
+ *
+ * The ESEARCH extension (RFC4731) returns the matching UIDs as a sequence set,
+ * e.g. `* ESEARCH (TAG "a0001") UID ALL 1:500,502,510:900`
+ */
+void cmd_parse_esearch(struct ImapAccountData *adata, const char *s)
+{
+  struct ImapMboxData *mdata = adata->mailbox->mdata;
+
+  mutt_debug(LL_DEBUG2, "Handling ESEARCH\n");
+
+  s = imap_next_word((char *) s);
+
+  /* skip the search correlator, e.g. (TAG "a0001") */
+  if (*s == '(')
+  {
+    s = imap_next_word((char *) s);
+    s = imap_next_word((char *) s);
+  }
+
+  if (mutt_istr_startswith(s, "UID "))
+    s = imap_next_word((char *) s);
+
+  /* the results are name/value pairs; we only asked for ALL */
+  while (*s != '\0')
+  {
+    const bool all = mutt_istr_startswith(s, "ALL ");
+    s = imap_next_word((char *) s);
+    if (*s == '\0')
+      break;
+
+    if (all)
+    {
+      const char *end = strpbrk(s, " \t");
+      char *seqset = end ? mutt_strn_dup(s, end - s) : mutt_str_dup(s);
+
+      struct SeqsetIterator *iter = mutt_seqset_iterator_new(seqset);
+      unsigned int uid = 0;
+      while (mutt_seqset_iterator_next(iter, &uid) == 0)
+      {
+        struct Email *e = mutt_hash_int_find(mdata->uid_hash, uid);
+        if (e)
+          e->matched = true;
+      }
+      mutt_seqset_iterator_free(&iter);
+      FREE(&seqset);
+    }
+
+    s = imap_next_word((char *) s);
+  }
+}
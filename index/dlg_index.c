@@ -818,6 +818,71 @@ int mutt_make_string(struct Buffer *buf, size_t max_cols,
                         NeoMutt->env, buf);
 }
 
+/**
+ * index_line_get - Get the cache entry for an Email's Index line
+ * @param priv Private Index data
+ * @param e    Email
+ * @retval ptr Cache entry
+ */
+static struct IndexLine *index_line_get(struct IndexPrivateData *priv, struct Email *e)
+{
+  if (e->index < 0)
+    return NULL;
+
+  struct IndexLine *il = ARRAY_GET(&priv->lines, e->index);
+  if (il)
+    return il;
+
+  struct IndexLine il_new = { 0 };
+  ARRAY_SET(&priv->lines, e->index, il_new);
+  return ARRAY_GET(&priv->lines, e->index);
+}
+
+/**
+ * index_op_is_motion - Does an operation only move the cursor?
+ * @param op Operation, e.g. OP_MAIN_NEXT_UNDELETED
+ * @retval true The cached Index lines are still valid
+ */
+static bool index_op_is_motion(int op)
+{
+  switch (op)
+  {
+    case OP_JUMP:
+    case OP_JUMP_1:
+    case OP_JUMP_2:
+    case OP_JUMP_3:
+    case OP_JUMP_4:
+    case OP_JUMP_5:
+    case OP_JUMP_6:
+    case OP_JUMP_7:
+    case OP_JUMP_8:
+    case OP_JUMP_9:
+    case OP_MAIN_NEXT_NEW:
+    case OP_MAIN_NEXT_NEW_THEN_UNREAD:
+    case OP_MAIN_NEXT_SUBTHREAD:
+    case OP_MAIN_NEXT_THREAD:
+    case OP_MAIN_NEXT_UNDELETED:
+    case OP_MAIN_NEXT_UNREAD:
+    case OP_MAIN_PARENT_MESSAGE:
+    case OP_MAIN_PREV_NEW:
+    case OP_MAIN_PREV_NEW_THEN_UNREAD:
+    case OP_MAIN_PREV_SUBTHREAD:
+    case OP_MAIN_PREV_THREAD:
+    case OP_MAIN_PREV_UNDELETED:
+    case OP_MAIN_PREV_UNREAD:
+    case OP_MAIN_ROOT_MESSAGE:
+    case OP_NEXT_ENTRY:
+    case OP_PREV_ENTRY:
+    case OP_SEARCH:
+    case OP_SEARCH_NEXT:
+    case OP_SEARCH_OPPOSITE:
+    case OP_SEARCH_REVERSE:
+      return true;
+    default:
+      return false;
+  }
+}
+
 /**
  * index_make_entry - Format an Email for the Menu - Implements Menu::make_entry() - @ingroup menu_make_entry
  *
@@ -918,7 +983,37 @@ int index_make_entry(struct Menu *menu, int line, int max_cols, struct Buffer *b
       max_cols -= (mutt_strwidth(c_arrow_string) + 1);
   }
 
-  return mutt_make_string(buf, max_cols, c_index_format, m, msg_in_pager, e, flags, NULL);
+  const time_t minute = mutt_date_now() / 60;
+  struct IndexLine *il = index_line_get(priv, e);
+  if (il && (il->email == e) && (il->gen == priv->lines_gen) && (il->line == line) &&
+      (il->max_cols == max_cols) && (il->flags == flags) &&
+      (il->msg_in_pager == msg_in_pager) && (il->minute == minute) &&
+      (il->collapsed == e->collapsed) && (il->num_hidden == e->num_hidden) &&
+      mutt_str_equal(il->tree, e->tree))
+  {
+    buf_addstr(buf, il->text);
+    return il->cols;
+  }
+
+  int cols = mutt_make_string(buf, max_cols, c_index_format, m, msg_in_pager, e, flags, NULL);
+
+  if (il)
+  {
+    il->email = e;
+    il->gen = priv->lines_gen;
+    mutt_str_replace(&il->text, buf_string(buf));
+    il->cols = cols;
+    il->line = line;
+    il->max_cols = max_cols;
+    il->flags = flags;
+    il->msg_in_pager = msg_in_pager;
+    il->minute = minute;
+    il->collapsed = e->collapsed;
+    il->num_hidden = e->num_hidden;
+    mutt_str_replace(&il->tree, e->tree);
+  }
+
+  return cols;
 }
 
 /**
@@ -1188,9 +1283,10 @@ struct Mailbox *dlg_index(struct MuttWindow *dlg, struct Mailbox *m_init)
         mutt_pattern_free(&shared->search_state->pattern);
       }
       else if ((check == MX_STATUS_NEW_MAIL) || (check == MX_STATUS_REOPENED) ||
-               (check == MX_STATUS_FLAGS))
+               (check == MX_STATUS_FLAGS) || (check == MX_STATUS_BACKFILL))
       {
-        /* notify the user of new mail */
+        /* notify the user of new mail; older Emails fetched in the background
+         * are added quietly */
         if (check == MX_STATUS_REOPENED)
         {
           mutt_error(_("Mailbox was externally modified.  Flags may be wrong."));
@@ -1370,6 +1466,11 @@ struct Mailbox *dlg_index(struct MuttWindow *dlg, struct Mailbox *m_init)
 
     rc = index_function_dispatcher(priv->win_index, op);
 
+    /* Many functions change Emails without sending a notification.
+     * Only the cursor movements can keep the cached lines. */
+    if ((rc != FR_UNKNOWN) && !index_op_is_motion(op))
+      index_lines_invalidate(priv);
+
     if (rc == FR_UNKNOWN)
       rc = menu_function_dispatcher(priv->win_index, op);
 
@@ -1379,7 +1480,10 @@ struct Mailbox *dlg_index(struct MuttWindow *dlg, struct Mailbox *m_init)
       rc = sb_function_dispatcher(win_sidebar, op);
     }
     if (rc == FR_UNKNOWN)
+    {
       rc = global_function_dispatcher(NULL, op);
+      index_lines_invalidate(priv);
+    }
 
     if (rc == FR_UNKNOWN)
       km_error_key(MENU_INDEX);
@@ -75,6 +75,7 @@
 #include "email/lib.h"
 #include "core/lib.h"
 #include "gui/lib.h"
+#include "lib.h"
 #include "attach/lib.h"
 #include "color/lib.h"
 #include "menu/lib.h"
@@ -216,6 +217,16 @@ static int config_reply_regex(struct MailboxView *mv)
   return 0;
 }
 
+/**
+ * index_lines_reset - Discard the Index's cached lines
+ * @param win Index Window
+ */
+static void index_lines_reset(struct MuttWindow *win)
+{
+  struct Menu *menu = win->wdata;
+  index_lines_invalidate(menu->mdata);
+}
+
 /**
  * index_altern_observer - Notification that an 'alternates' command has occurred - Implements ::observer_t - @ingroup observer_api
  */
@@ -231,6 +242,7 @@ static int index_altern_observer(struct NotifyCallback *nc)
   struct IndexSharedData *shared = dlg->wdata;
 
   mutt_alternates_reset(shared->mailbox_view);
+  index_lines_reset(win);
   mutt_debug(LL_DEBUG5, "alternates done\n");
   return 0;
 }
@@ -250,6 +262,7 @@ static int index_attach_observer(struct NotifyCallback *nc)
   struct IndexSharedData *shared = dlg->wdata;
 
   mutt_attachments_reset(shared->mailbox_view);
+  index_lines_reset(win);
   mutt_debug(LL_DEBUG5, "attachments done\n");
   return 0;
 }
@@ -290,6 +303,7 @@ static int index_color_observer(struct NotifyCallback *nc)
     return 0;
 
   // Force re-caching of index colours
+  index_lines_reset(win);
   for (int i = 0; i < m->msg_count; i++)
   {
     struct Email *e = m->emails[i];
@@ -394,6 +408,7 @@ static int index_config_observer(struct NotifyCallback *nc)
     return 0;
 
   struct MuttWindow *win = nc->global_data;
+  index_lines_reset(win);
 
   if (!config_check_sort(ev_c->name) && !config_check_index(ev_c->name))
     return 0;
@@ -445,6 +460,7 @@ static int index_global_observer(struct NotifyCallback *nc)
 
   struct IndexSharedData *shared = dlg->wdata;
   mutt_check_rescore(shared->mailbox);
+  index_lines_reset(win);
 
   return 0;
 }
@@ -460,6 +476,10 @@ static int index_index_observer(struct NotifyCallback *nc)
   struct MuttWindow *win = nc->global_data;
   win->actions |= WA_RECALC;
 
+  // Moving the cursor doesn't change any Emails
+  if ((nc->event_type != NT_INDEX) || (nc->event_subtype != NT_INDEX_EMAIL))
+    index_lines_reset(win);
+
   struct Menu *menu = win->wdata;
   menu_queue_redraw(menu, MENU_REDRAW_INDEX);
   mutt_debug(LL_DEBUG5, "index done, request WA_RECALC\n");
@@ -523,6 +543,7 @@ static int index_score_observer(struct NotifyCallback *nc)
     mutt_score_message(m, e, true);
     e->attr_color = NULL; // Force recalc of colour
   }
+  index_lines_reset(win);
 
   mutt_debug(LL_DEBUG5, "score done\n");
   return 0;
@@ -543,6 +564,7 @@ static int index_subjrx_observer(struct NotifyCallback *nc)
   struct IndexSharedData *shared = dlg->wdata;
 
   subjrx_clear_mods(shared->mailbox_view);
+  index_lines_reset(win);
   mutt_debug(LL_DEBUG5, "subjectrx done\n");
   return 0;
 }
@@ -562,7 +584,10 @@ static int index_window_observer(struct NotifyCallback *nc)
   if (nc->event_subtype != NT_WINDOW_DELETE)
   {
     if (nc->event_subtype != NT_WINDOW_FOCUS)
+    {
+      index_lines_invalidate(menu->mdata);
       menu_queue_redraw(menu, MENU_REDRAW_FULL | MENU_REDRAW_INDEX);
+    }
     return 0;
   }
 
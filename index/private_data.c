@@ -38,6 +38,16 @@ void index_private_data_free(struct MuttWindow *win, void **ptr)
   if (!ptr || !*ptr)
     return;
 
+  struct IndexPrivateData *priv = *ptr;
+
+  struct IndexLine *il = NULL;
+  ARRAY_FOREACH(il, &priv->lines)
+  {
+    FREE(&il->text);
+    FREE(&il->tree);
+  }
+  ARRAY_FREE(&priv->lines);
+
   FREE(ptr);
 }
 
@@ -55,3 +65,17 @@ struct IndexPrivateData *index_private_data_new(struct IndexSharedData *shared)
 
   return priv;
 }
+
+/**
+ * index_lines_invalidate - Discard the cached Index lines
+ * @param priv Private Index data
+ *
+ * The lines aren't freed, they will be replaced when they're next rendered.
+ */
+void index_lines_invalidate(struct IndexPrivateData *priv)
+{
+  if (!priv)
+    return;
+
+  priv->lines_gen++;
+}
@@ -24,10 +24,37 @@
 #define MUTT_INDEX_PRIVATE_DATA_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+#include "mutt/lib.h"
+#include "expando/lib.h"
 
+struct Email;
 struct IndexSharedData;
 struct MuttWindow;
 
+/**
+ * struct IndexLine - A rendered line of the Index
+ *
+ * The line is only valid if all the parameters match those of the next render.
+ */
+struct IndexLine
+{
+  const struct Email *email;  ///< Email that was rendered
+  unsigned int gen;           ///< Generation of the cache, see IndexPrivateData.lines_gen
+  char *text;                 ///< Rendered text, including the colour markers
+  int cols;                   ///< Number of screen columns used
+  int line;                   ///< Menu line (virtual number)
+  int max_cols;               ///< Width of the render
+  MuttFormatFlags flags;      ///< Format flags, e.g. #MUTT_FORMAT_TREE
+  int msg_in_pager;           ///< Email being displayed in the Pager
+  time_t minute;              ///< Time of the render, for relative dates
+  bool collapsed;             ///< Was the thread collapsed?
+  size_t num_hidden;          ///< Number of hidden messages in the thread
+  char *tree;                 ///< Thread tree
+};
+ARRAY_HEAD(IndexLineArray, struct IndexLine);
+
 /**
  * struct IndexPrivateData - Private state data for the Index
  */
@@ -40,9 +67,14 @@ struct IndexPrivateData
   struct IndexSharedData *shared; ///< Shared Index data
   struct Menu *menu;              ///< Menu controlling the index
   struct MuttWindow *win_index;   ///< Window for the Index
+
+  struct IndexLineArray lines;    ///< Cache of rendered lines, indexed by Email.index
+  unsigned int lines_gen;         ///< Generation of the line cache
 };
 
 void                     index_private_data_free(struct MuttWindow *win, void **ptr);
 struct IndexPrivateData *index_private_data_new (struct IndexSharedData *shared);
 
+void index_lines_invalidate(struct IndexPrivateData *priv);
+
 #endif /* MUTT_INDEX_PRIVATE_DATA_H */
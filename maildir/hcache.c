@@ -37,6 +37,7 @@
 #include "hcache/lib.h"
 #include "edata.h"
 #include "mailbox.h"
+#include "mdata.h"
 
 /**
  * maildir_hcache_key - Get the header cache key for an Email
@@ -162,3 +163,58 @@ int maildir_hcache_store(struct HeaderCache *hc, struct Email *e)
 
   return hcache_store_email(hc, key, keylen, e, 0);
 }
+
+/**
+ * maildir_hcache_stats_key - Get the Header Cache key for a directory's counts
+ * @param dir_name Subdirectory, "new" or "cur"
+ * @param buf      Buffer for the key
+ *
+ * Email keys are file names, so they can never contain a '/'.
+ */
+static void maildir_hcache_stats_key(const char *dir_name, struct Buffer *buf)
+{
+  buf_printf(buf, "/stats/%s", dir_name);
+}
+
+/**
+ * maildir_hcache_stats_read - Read a directory's message counts from the Header Cache
+ * @param[in]  m        Mailbox
+ * @param[in]  dir_name Subdirectory, "new" or "cur"
+ * @param[out] stats    Message counts
+ * @retval true Success
+ */
+bool maildir_hcache_stats_read(struct Mailbox *m, const char *dir_name,
+                               struct MaildirDirStats *stats)
+{
+  struct HeaderCache *hc = maildir_hcache_open(m);
+  if (!hc)
+    return false;
+
+  struct Buffer *key = buf_pool_get();
+  maildir_hcache_stats_key(dir_name, key);
+  bool rc = hcache_fetch_raw_obj(hc, buf_string(key), buf_len(key), stats);
+  buf_pool_release(&key);
+  hcache_close(&hc);
+
+  return rc;
+}
+
+/**
+ * maildir_hcache_stats_store - Save a directory's message counts to the Header Cache
+ * @param m        Mailbox
+ * @param dir_name Subdirectory, "new" or "cur"
+ * @param stats    Message counts
+ */
+void maildir_hcache_stats_store(struct Mailbox *m, const char *dir_name,
+                                struct MaildirDirStats *stats)
+{
+  struct HeaderCache *hc = maildir_hcache_open(m);
+  if (!hc)
+    return;
+
+  struct Buffer *key = buf_pool_get();
+  maildir_hcache_stats_key(dir_name, key);
+  hcache_store_raw(hc, buf_string(key), buf_len(key), stats, sizeof(*stats));
+  buf_pool_release(&key);
+  hcache_close(&hc);
+}
@@ -23,11 +23,13 @@
 #ifndef MUTT_MAILDIR_HCACHE_H
 #define MUTT_MAILDIR_HCACHE_H
 
+#include <stdbool.h>
 #include <stdlib.h>
 
 struct Email;
 struct HeaderCache;
 struct Mailbox;
+struct MaildirDirStats;
 
 #ifdef USE_HCACHE
 
@@ -36,6 +38,8 @@ int                 maildir_hcache_delete(struct HeaderCache *hc, struct Email *
 struct HeaderCache *maildir_hcache_open  (struct Mailbox *m);
 struct Email *      maildir_hcache_read  (struct HeaderCache *hc, struct Email *e, const char *fn);
 int                 maildir_hcache_store (struct HeaderCache *hc, struct Email *e);
+bool                maildir_hcache_stats_read (struct Mailbox *m, const char *dir_name, struct MaildirDirStats *stats);
+void                maildir_hcache_stats_store(struct Mailbox *m, const char *dir_name, struct MaildirDirStats *stats);
 
 #else
 
@@ -44,6 +48,8 @@ static inline int                 maildir_hcache_delete(struct HeaderCache *hc,
 static inline struct HeaderCache *maildir_hcache_open  (struct Mailbox *m) { return NULL; }
 static inline struct Email *      maildir_hcache_read  (struct HeaderCache *hc, struct Email *e, const char *fn) { return NULL; }
 static inline int                 maildir_hcache_store (struct HeaderCache *hc, struct Email *e) { return 0; }
+static inline bool                maildir_hcache_stats_read (struct Mailbox *m, const char *dir_name, struct MaildirDirStats *stats) { return false; }
+static inline void                maildir_hcache_stats_store(struct Mailbox *m, const char *dir_name, struct MaildirDirStats *stats) {}
 
 #endif
 
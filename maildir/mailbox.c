@@ -46,6 +46,7 @@
 #include "mx.h"
 #include "shared.h"
 #ifdef USE_INOTIFY
+#include <sys/inotify.h>
 #include "monitor.h"
 #endif
 
@@ -377,6 +378,65 @@ static void maildir_delayed_parsing(struct Mailbox *m, struct MdEmailArray *mda,
   maildir_hcache_close(&hc);
 }
 
+/**
+ * maildir_stats_get - Get the cached counts for a Maildir subdirectory
+ * @param m        Mailbox
+ * @param dir_name Subdirectory, "new" or "cur"
+ * @retval ptr Cached counts
+ *
+ * The first time, the counts are loaded from the Header Cache.
+ */
+static struct MaildirDirStats *maildir_stats_get(struct Mailbox *m, const char *dir_name)
+{
+  struct MaildirMboxData *mdata = maildir_mdata_get(m);
+  if (!mdata)
+  {
+    mdata = maildir_mdata_new();
+    m->mdata = mdata;
+    m->mdata_free = maildir_mdata_free;
+  }
+
+  struct MaildirDirStats *stats = &mdata->stats[mutt_str_equal(dir_name, "cur") ? 1 : 0];
+
+  if (!mdata->stats_loaded)
+  {
+    mdata->stats_loaded = true;
+    if (!maildir_hcache_stats_read(m, "new", &mdata->stats[0]))
+      memset(&mdata->stats[0], 0, sizeof(mdata->stats[0]));
+    if (!maildir_hcache_stats_read(m, "cur", &mdata->stats[1]))
+      memset(&mdata->stats[1], 0, sizeof(mdata->stats[1]));
+  }
+
+  return stats;
+}
+
+/**
+ * maildir_stats_valid - Can the cached counts be used?
+ * @param m         Mailbox
+ * @param stats     Cached counts
+ * @param st        stat() info for the subdirectory
+ * @param delimiter $maildir_field_delimiter
+ * @param check_new true if the number of new messages is needed
+ * @param recent    $mail_check_recent
+ * @retval true The counts are up to date
+ */
+static bool maildir_stats_valid(struct Mailbox *m, struct MaildirDirStats *stats,
+                                struct stat *st, char delimiter, bool check_new, bool recent)
+{
+  if ((mutt_file_stat_timespec_compare(st, MUTT_STAT_MTIME, &stats->mtime) != 0) ||
+      (st->st_dev != stats->dev) || (st->st_ino != stats->ino) ||
+      (stats->delimiter != delimiter))
+  {
+    return false;
+  }
+
+  if (!check_new)
+    return true;
+
+  return stats->new_valid && (stats->recent == recent) &&
+         (mutt_file_timespec_compare(&stats->last_visited, &m->last_visited) == 0);
+}
+
 /**
  * maildir_check_dir - Check for new mail / mail counts
  * @param m           Mailbox to check
@@ -385,6 +445,9 @@ static void maildir_delayed_parsing(struct Mailbox *m, struct MdEmailArray *mda,
  * @param check_stats if true, count total, new, and flagged messages
  *
  * Checks the specified maildir subdir (cur or new) for new mail or mail counts.
+ *
+ * The counts are cached, and saved in the Header Cache.  The directory is only
+ * read again when its modification time changes.
  */
 static void maildir_check_dir(struct Mailbox *m, const char *dir_name,
                               bool check_new, bool check_stats)
@@ -393,18 +456,21 @@ static void maildir_check_dir(struct Mailbox *m, const char *dir_name,
   struct dirent *de = NULL;
   char *p = NULL;
   struct stat st = { 0 };
+  struct stat st_dir = { 0 };
 
   struct Buffer *path = buf_pool_get();
   struct Buffer *msgpath = buf_pool_get();
   buf_printf(path, "%s/%s", mailbox_path(m), dir_name);
 
+  const bool have_dir = (stat(buf_string(path), &st_dir) == 0);
+
   /* when $mail_check_recent is set, if the new/ directory hasn't been modified since
    * the user last exited the mailbox, then we know there is no recent mail.  */
   const bool c_mail_check_recent = cs_subset_bool(NeoMutt->sub, "mail_check_recent");
   if (check_new && c_mail_check_recent)
   {
-    if ((stat(buf_string(path), &st) == 0) &&
-        (mutt_file_stat_timespec_compare(&st, MUTT_STAT_MTIME, &m->last_visited) < 0))
+    if (have_dir &&
+        (mutt_file_stat_timespec_compare(&st_dir, MUTT_STAT_MTIME, &m->last_visited) < 0))
     {
       check_new = false;
     }
@@ -413,6 +479,16 @@ static void maildir_check_dir(struct Mailbox *m, const char *dir_name,
   if (!(check_new || check_stats))
     goto cleanup;
 
+  const char c_maildir_field_delimiter = *cc_maildir_field_delimiter();
+
+  struct MaildirDirStats *stats = maildir_stats_get(m, dir_name);
+  if (have_dir && maildir_stats_valid(m, stats, &st_dir, c_maildir_field_delimiter,
+                                      check_new, c_mail_check_recent))
+  {
+    goto apply;
+  }
+
+  mutt_debug(LL_DEBUG3, "counting %s\n", buf_string(path));
   dir = mutt_file_opendir(buf_string(path), MUTT_OPENDIR_CREATE);
   if (!dir)
   {
@@ -420,7 +496,7 @@ static void maildir_check_dir(struct Mailbox *m, const char *dir_name,
     goto cleanup;
   }
 
-  const char c_maildir_field_delimiter = *cc_maildir_field_delimiter();
+  struct MaildirDirStats ds = { 0 };
 
   char delimiter_version[8] = { 0 };
   snprintf(delimiter_version, sizeof(delimiter_version), "%c2,", c_maildir_field_delimiter);
@@ -433,16 +509,13 @@ static void maildir_check_dir(struct Mailbox *m, const char *dir_name,
     if (p && strchr(p + 3, 'T'))
       continue;
 
-    if (check_stats)
-    {
-      m->msg_count++;
-      if (p && strchr(p + 3, 'F'))
-        m->msg_flagged++;
-    }
+    ds.count++;
+    if (p && strchr(p + 3, 'F'))
+      ds.flagged++;
+
     if (!p || !strchr(p + 3, 'S'))
     {
-      if (check_stats)
-        m->msg_unread++;
+      ds.unread++;
       if (check_new)
       {
         if (c_mail_check_recent)
@@ -455,21 +528,48 @@ static void maildir_check_dir(struct Mailbox *m, const char *dir_name,
             continue;
           }
         }
-        m->has_new = true;
-        if (check_stats)
-        {
-          m->msg_new++;
-        }
-        else
-        {
-          break;
-        }
+        ds.new++;
       }
     }
   }
 
   closedir(dir);
 
+  ds.new_valid = check_new;
+  ds.recent = c_mail_check_recent;
+  ds.last_visited = m->last_visited;
+  ds.delimiter = c_maildir_field_delimiter;
+
+  /* Only trust the counts if the directory wasn't modified while we read it.
+   * Timestamps may only have a resolution of one second. */
+  const bool stable = have_dir && (stat(buf_string(path), &st) == 0) &&
+                      (mutt_file_stat_compare(&st, MUTT_STAT_MTIME, &st_dir, MUTT_STAT_MTIME) == 0) &&
+                      (st_dir.st_mtime < (mutt_date_now() - 1));
+  if (stable)
+  {
+    mutt_file_get_stat_timespec(&ds.mtime, &st_dir, MUTT_STAT_MTIME);
+    ds.dev = st_dir.st_dev;
+    ds.ino = st_dir.st_ino;
+  }
+
+  *stats = ds;
+  if (stable)
+    maildir_hcache_stats_store(m, dir_name, stats);
+
+apply:
+  if (check_stats)
+  {
+    m->msg_count += stats->count;
+    m->msg_unread += stats->unread;
+    m->msg_flagged += stats->flagged;
+  }
+  if (check_new && (stats->new > 0))
+  {
+    m->has_new = true;
+    if (check_stats)
+      m->msg_new += stats->new;
+  }
+
 cleanup:
   buf_pool_release(&path);
   buf_pool_release(&msgpath);
@@ -528,6 +628,168 @@ static int maildir_read_dir(struct Mailbox *m, const char *subdir)
   return 0;
 }
 
+/**
+ * maildir_merge_email - Merge a rescanned file into an existing Email
+ * @param m  Mailbox
+ * @param e  Existing Email
+ * @param md Maildir entry for the same message, its Email will be freed
+ * @retval true The flags of the Email changed
+ */
+static bool maildir_merge_email(struct Mailbox *m, struct Email *e, struct MdEmail *md)
+{
+  bool flags_changed = false;
+
+  /* check to see if the message has moved to a different
+   * subdirectory.  If so, update the associated filename.  */
+  if (!mutt_str_equal(e->path, md->email->path))
+    mutt_str_replace(&e->path, md->email->path);
+
+  /* if the user hasn't modified the flags on this message, update
+   * the flags we just detected.  */
+  if (!e->changed)
+    if (maildir_update_flags(m, e, md->email))
+      flags_changed = true;
+
+  if (e->deleted == e->trash)
+  {
+    if (e->deleted != md->email->deleted)
+    {
+      e->deleted = md->email->deleted;
+      flags_changed = true;
+    }
+  }
+  e->trash = md->email->trash;
+
+  /* this is a duplicate of an existing email, so remove it */
+  email_free(&md->email);
+
+  return flags_changed;
+}
+
+#ifdef USE_INOTIFY
+/**
+ * maildir_check_events - Apply the file changes seen by the monitor
+ * @param m Mailbox
+ * @retval enum #MxStatus
+ *
+ * Rather than rescanning the new and cur subdirectories, only look at the
+ * files that the monitor saw being added, renamed or removed.
+ */
+static enum MxStatus maildir_check_events(struct Mailbox *m)
+{
+  bool occult = false;
+  bool flags_changed = false;
+  struct MdEmailArray mda = ARRAY_HEAD_INITIALIZER;
+  struct Buffer *buf = buf_pool_get();
+  struct Buffer *path = buf_pool_get();
+  struct stat st = { 0 };
+
+  // Hash Table: "base-filename" -> MdEmail
+  struct HashTable *hash_names = mutt_hash_new(ARRAY_SIZE(&MonitorCurMboxEvents),
+                                               MUTT_HASH_NO_FLAGS);
+
+  /* Replay the events, the last one for each message wins */
+  struct MdEmail *md = NULL;
+  struct MonitorEvent *ev = NULL;
+  ARRAY_FOREACH(ev, &MonitorCurMboxEvents)
+  {
+    maildir_canon_filename(buf, ev->name);
+    md = mutt_hash_find(hash_names, buf_string(buf));
+    if (!md)
+    {
+      md = maildir_entry_new();
+      md->canon_fname = buf_strdup(buf);
+      mutt_hash_insert(hash_names, md->canon_fname, md);
+      ARRAY_ADD(&mda, md);
+    }
+
+    if (ev->mask & (IN_MOVED_FROM | IN_DELETE))
+    {
+      if (md->email && mutt_str_equal(md->email->path, ev->name))
+        email_free(&md->email);
+    }
+    else if (ev->mask & (IN_CREATE | IN_MOVED_TO | IN_CLOSE_WRITE))
+    {
+      email_free(&md->email);
+      md->email = maildir_email_new();
+      md->email->old = mutt_str_startswith(ev->name, "cur/");
+      maildir_parse_flags(md->email, ev->name);
+      md->email->path = mutt_str_dup(ev->name);
+    }
+  }
+
+  /* The file may have gone again, the monitor will tell us later */
+  struct MdEmail **mdp = NULL;
+  ARRAY_FOREACH(mdp, &mda)
+  {
+    md = *mdp;
+    if (!md->email)
+      continue;
+    buf_printf(path, "%s/%s", mailbox_path(m), md->email->path);
+    if (stat(buf_string(path), &st) != 0)
+      email_free(&md->email);
+  }
+
+  /* Update the emails we already know about */
+  for (int i = 0; i < m->msg_count; i++)
+  {
+    struct Email *e = m->emails[i];
+    if (!e)
+      break;
+
+    maildir_canon_filename(buf, e->path);
+    md = mutt_hash_find(hash_names, buf_string(buf));
+    if (!md)
+      continue;
+
+    if (md->email)
+    {
+      if (maildir_merge_email(m, e, md))
+        flags_changed = true;
+      continue;
+    }
+
+    /* Nothing was added for this message, check it's still there */
+    buf_printf(path, "%s/%s", mailbox_path(m), e->path);
+    if (stat(buf_string(path), &st) != 0)
+    {
+      occult = true;
+      e->deleted = true;
+      e->purge = true;
+    }
+  }
+
+  mutt_hash_free(&hash_names);
+
+  if (occult)
+    mailbox_changed(m, NT_MAILBOX_RESORT);
+
+  /* Anything left over is new */
+  maildir_delayed_parsing(m, &mda, NULL);
+  int num_new = maildir_move_to_mailbox(m, &mda);
+  maildirarray_clear(&mda);
+
+  mutt_debug(LL_DEBUG3, "%d events: %d new\n", ARRAY_SIZE(&MonitorCurMboxEvents), num_new);
+
+  if (num_new > 0)
+  {
+    mailbox_changed(m, NT_MAILBOX_INVALID);
+    m->changed = true;
+  }
+
+  buf_pool_release(&buf);
+  buf_pool_release(&path);
+
+  if (occult)
+    return MX_STATUS_REOPENED;
+  if (num_new > 0)
+    return MX_STATUS_NEW_MAIL;
+  if (flags_changed)
+    return MX_STATUS_FLAGS;
+  return MX_STATUS_OK;
+}
+#endif
+
 /**
  * maildir_check - Check for new mail
  * @param m Mailbox
@@ -570,11 +832,33 @@ static enum MxStatus maildir_check(struct Mailbox *m)
     return MX_STATUS_ERROR;
   }
 
+#ifdef USE_INOTIFY
+  /* The monitor has recorded which files changed, so there's no need to
+   * rescan.  Any change made after the stat()s above will produce another
+   * event, so the modification times can be recorded now.  If events were
+   * lost, MonitorCurMboxOverflow forces a full scan instead. */
+  if (MonitorCurMboxChanged && !MonitorCurMboxOverflow)
+  {
+    MonitorCurMboxChanged = false;
+    mutt_file_get_stat_timespec(&mdata->mtime, &st_new, MUTT_STAT_MTIME);
+    mutt_file_get_stat_timespec(&mdata->mtime_cur, &st_cur, MUTT_STAT_MTIME);
+    buf_pool_release(&buf);
+
+    enum MxStatus rc = maildir_check_events(m);
+    mutt_monitor_events_clear();
+    return rc;
+  }
+#endif
+
   /* determine which subdirectories need to be scanned */
   if (mutt_file_stat_timespec_compare(&st_new, MUTT_STAT_MTIME, &mdata->mtime) > 0)
     changed = MMC_NEW_DIR;
   if (mutt_file_stat_timespec_compare(&st_cur, MUTT_STAT_MTIME, &mdata->mtime_cur) > 0)
     changed |= MMC_CUR_DIR;
+#ifdef USE_INOTIFY
+  if (MonitorCurMboxOverflow)
+    changed = MMC_NEW_DIR | MMC_CUR_DIR;
+#endif
 
   if (changed == MMC_NO_DIRS)
   {
@@ -607,6 +891,10 @@ static enum MxStatus maildir_check(struct Mailbox *m)
     maildir_parse_dir(m, &mda, "new", NULL);
   if (changed & MMC_CUR_DIR)
     maildir_parse_dir(m, &mda, "cur", NULL);
+#ifdef USE_INOTIFY
+  /* the scan supersedes any recorded changes */
+  mutt_monitor_events_clear();
+#endif
 
   /* we create a hash table keyed off the canonical (sans flags) filename
    * of each message we scanned.  This is used in the loop over the
@@ -634,31 +922,8 @@ static enum MxStatus maildir_check(struct Mailbox *m)
     md = mutt_hash_find(hash_names, buf_string(buf));
     if (md && md->email)
     {
-      /* message already exists, merge flags */
-
-      /* check to see if the message has moved to a different
-       * subdirectory.  If so, update the associated filename.  */
-      if (!mutt_str_equal(e->path, md->email->path))
-        mutt_str_replace(&e->path, md->email->path);
-
-      /* if the user hasn't modified the flags on this message, update
-       * the flags we just detected.  */
-      if (!e->changed)
-        if (maildir_update_flags(m, e, md->email))
-          flags_changed = true;
-
-      if (e->deleted == e->trash)
-      {
-        if (e->deleted != md->email->deleted)
-        {
-          e->deleted = md->email->deleted;
-          flags_changed = true;
-        }
-      }
-      e->trash = md->email->trash;
-
-      /* this is a duplicate of an existing email, so remove it */
-      email_free(&md->email);
+      if (maildir_merge_email(m, e, md))
+        flags_changed = true;
     }
     /* This message was not in the list of messages we just scanned.
      * Check to see if we have enough information to know if the
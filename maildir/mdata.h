@@ -23,19 +23,42 @@
 #ifndef MUTT_MAILDIR_MDATA_H
 #define MUTT_MAILDIR_MDATA_H
 
+#include <stdbool.h>
 #include <sys/types.h>
 #include <time.h>
 
 struct Mailbox;
 
+/**
+ * struct MaildirDirStats - Cached message counts for a Maildir subdirectory
+ *
+ * The counts are valid while the directory's modification time is unchanged.
+ */
+struct MaildirDirStats
+{
+  struct timespec mtime;        ///< Modification time of the directory when counted
+  dev_t dev;                    ///< Device of the directory
+  ino_t ino;                    ///< Inode of the directory
+  char delimiter;               ///< $maildir_field_delimiter used when counting
+  bool new_valid;               ///< The `new` count is valid
+  bool recent;                  ///< $mail_check_recent was set when counting `new`
+  struct timespec last_visited; ///< Mailbox::last_visited when counting `new`
+  int count;                    ///< Number of messages
+  int unread;                   ///< Number of unread messages
+  int flagged;                  ///< Number of flagged messages
+  int new;                      ///< Number of new messages
+};
+
 /**
  * struct MaildirMboxData - Maildir-specific Mailbox data - @extends Mailbox
  */
 struct MaildirMboxData
 {
-  struct timespec mtime;     ///< Time Mailbox was last changed
-  struct timespec mtime_cur; ///< Timestamp of the 'cur' dir
-  mode_t umask;              ///< umask to use when creating files
+  struct timespec mtime;           ///< Time Mailbox was last changed
+  struct timespec mtime_cur;       ///< Timestamp of the 'cur' dir
+  mode_t umask;                    ///< umask to use when creating files
+  struct MaildirDirStats stats[2]; ///< Cached counts for the 'new' and 'cur' dirs
+  bool stats_loaded;               ///< The counts have been read from the Header Cache
 };
 
 void                    maildir_mdata_free(void **ptr);
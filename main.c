@@ -160,6 +160,7 @@
 #include "ncrypt/lib.h"
 #include "nntp/lib.h"
 #include "notmuch/lib.h"
+#include "pager/lib.h"
 #include "parse/lib.h"
 #include "pop/lib.h"
 #include "postpone/lib.h"
@@ -1961,6 +1962,7 @@ main_ok:
 main_curses:
   mutt_endwin();
   mutt_temp_attachments_cleanup();
+  pager_render_cache_cleanup();
   /* Repeat the last message to the user */
   if (repeat_error && ErrorBufMessage)
     puts(ErrorBuf);
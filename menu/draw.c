@@ -43,22 +43,69 @@
 #include "mutt_thread.h"
 #include "mview.h"
 
+/**
+ * struct PatternResult - Result of matching a colour Pattern against an Email
+ */
+struct PatternResult
+{
+  const char *pattern; ///< Pattern string, e.g. "~N"
+  bool matched;        ///< Did the Pattern match?
+};
+ARRAY_HEAD(PatternResultArray, struct PatternResult);
+
+/**
+ * struct LineColors - Colour matches for one line of the Index
+ *
+ * All the colour markers in a line refer to the same Email.
+ * The `color index_*` lists often repeat the same patterns, e.g. "~N", so
+ * each distinct pattern is only executed once per line.
+ */
+struct LineColors
+{
+  struct Mailbox *mailbox;           ///< Mailbox
+  struct Email *email;               ///< Email for this line
+  struct PatternCache cache;         ///< Shared cache of slow pattern operations
+  struct PatternResultArray results; ///< Patterns already matched
+};
+
+/**
+ * line_colors_match - Match a colour Pattern against the line's Email
+ * @param lc   Line colours
+ * @param rcol Colour rule
+ * @retval true The Pattern matches the Email
+ */
+static bool line_colors_match(struct LineColors *lc, struct RegexColor *rcol)
+{
+  struct PatternResult *pr = NULL;
+  ARRAY_FOREACH(pr, &lc->results)
+  {
+    if (mutt_str_equal(pr->pattern, rcol->pattern))
+      return pr->matched;
+  }
+
+  struct PatternResult result = { rcol->pattern, false };
+  result.matched = mutt_pattern_exec(SLIST_FIRST(rcol->color_pattern),
+                                     MUTT_MATCH_FULL_ADDRESS, lc->mailbox,
+                                     lc->email, &lc->cache);
+  ARRAY_ADD(&lc->results, result);
+
+  return result.matched;
+}
+
 /**
  * get_color - Choose a colour for a line of the index
- * @param index Index number
- * @param s     String of embedded colour codes
- * @retval num Colour pair in an integer
+ * @param lc    Line colours
+ * @param s     Colour string
+ * @retval ptr Colour
  *
  * Text is coloured by inserting special characters into the string, e.g.
  * #MT_COLOR_INDEX_AUTHOR
  */
-static const struct AttrColor *get_color(int index, unsigned char *s)
+static const struct AttrColor *get_color(struct LineColors *lc, unsigned char *s)
 {
   const int type = *s;
   struct RegexColorList *rcl = regex_colors_get_list(type);
-  struct Mailbox *m_cur = get_current_mailbox();
-  struct Email *e = mutt_get_virt_email(m_cur, index);
-  if (!rcl || !e)
+  if (!rcl || !lc->email)
   {
     return simple_color_get(type);
   }
@@ -87,8 +134,7 @@ static const struct AttrColor *get_color(int index, unsigned char *s)
   const struct AttrColor *ac_merge = NULL;
   STAILQ_FOREACH(np, rcl, entries)
   {
-    if (mutt_pattern_exec(SLIST_FIRST(np->color_pattern),
-                          MUTT_MATCH_FULL_ADDRESS, m_cur, e, NULL))
+    if (line_colors_match(lc, np))
     {
       ac_merge = merged_color_overlay(ac_merge, &np->attr_color);
     }
@@ -115,6 +161,7 @@ static void print_enriched_string(struct MuttWindow *win, int index,
   size_t n = mutt_str_len(buf_string(buf));
   unsigned char *s = (unsigned char *) buf->data;
   mbstate_t mbstate = { 0 };
+  struct LineColors lc = { 0 };
 
   const bool c_ascii_chars = cs_subset_bool(sub, "ascii_chars");
   while (*s)
@@ -255,7 +302,13 @@ static void print_enriched_string(struct MuttWindow *win, int index,
       }
       else
       {
-        const struct AttrColor *color = get_color(index, s);
+        if (!lc.email)
+        {
+          lc.mailbox = get_current_mailbox();
+          lc.email = mutt_get_virt_email(lc.mailbox, index);
+        }
+
+        const struct AttrColor *color = get_color(&lc, s);
         const struct AttrColor *ac_merge = merged_color_overlay(ac_def, color);
         ac_merge = merged_color_overlay(ac_merge, ac_ind);
 
@@ -275,6 +328,8 @@ static void print_enriched_string(struct MuttWindow *win, int index,
       break;
     }
   }
+
+  ARRAY_FREE(&lc.results);
 }
 
 /**
@@ -53,6 +53,10 @@
 bool MonitorFilesChanged = false;
 /// Set to true when the current mailbox has changed
 bool MonitorCurMboxChanged = false;
+/// Set to true when changes to the current mailbox were lost
+bool MonitorCurMboxOverflow = false;
+/// Files that have changed in the current mailbox
+struct MonitorEventArray MonitorCurMboxEvents = ARRAY_HEAD_INITIALIZER;
 
 /// Inotify file descriptor
 static int INotifyFd = -1;
@@ -66,10 +70,15 @@ static size_t PollFdsLen = 0;
 static struct pollfd *PollFds = NULL;
 /// Monitor file descriptor of the current mailbox
 static int MonitorCurMboxDescriptor = -1;
+/// Monitor file descriptor of the current Maildir's "cur" directory
+static int MonitorCurMboxCurDescriptor = -1;
 
-#define INOTIFY_MASK_DIR (IN_MOVED_TO | IN_ATTRIB | IN_CLOSE_WRITE | IN_ISDIR)
+#define INOTIFY_MASK_DIR (IN_CREATE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_ATTRIB | IN_CLOSE_WRITE | IN_ISDIR)
 #define INOTIFY_MASK_FILE IN_CLOSE_WRITE
 
+/// Maximum number of events to record, after that a rescan is quicker
+#define MONITOR_EVENTS_MAX 4096
+
 #define EVENT_BUFLEN MAX(4096, sizeof(struct inotify_event) + NAME_MAX + 1)
 
 /**
@@ -204,10 +213,104 @@ static void monitor_check_cleanup(void)
     mutt_poll_fd_remove(INotifyFd);
     close(INotifyFd);
     INotifyFd = -1;
+    MonitorCurMboxCurDescriptor = -1;
     MonitorFilesChanged = false;
   }
 }
 
+/**
+ * mutt_monitor_events_clear - Forget the changes to the current mailbox
+ */
+void mutt_monitor_events_clear(void)
+{
+  struct MonitorEvent *ev = NULL;
+  ARRAY_FOREACH(ev, &MonitorCurMboxEvents)
+  {
+    FREE(&ev->name);
+  }
+  ARRAY_FREE(&MonitorCurMboxEvents);
+  MonitorCurMboxOverflow = false;
+}
+
+/**
+ * monitor_event_add - Record a change to a file in the current mailbox
+ * @param event  inotify event
+ * @param subdir Maildir subdirectory, "new" or "cur"
+ */
+static void monitor_event_add(const struct inotify_event *event, const char *subdir)
+{
+  if ((event->len == 0) || (event->mask & IN_ISDIR) || (event->name[0] == '.'))
+    return;
+
+  if (MonitorCurMboxOverflow)
+    return;
+
+  /* Only a Maildir's events are replayed, see maildir_check().
+   * For anything else, e.g. MH, just note that the mailbox must be scanned. */
+  if (MonitorCurMboxCurDescriptor == -1)
+  {
+    MonitorCurMboxOverflow = true;
+    return;
+  }
+
+  if (ARRAY_SIZE(&MonitorCurMboxEvents) >= MONITOR_EVENTS_MAX)
+  {
+    mutt_monitor_events_clear();
+    MonitorCurMboxOverflow = true;
+    return;
+  }
+
+  struct Buffer *buf = buf_pool_get();
+  buf_printf(buf, "%s/%s", subdir, event->name);
+  struct MonitorEvent ev = { buf_strdup(buf), event->mask };
+  ARRAY_ADD(&MonitorCurMboxEvents, ev);
+  buf_pool_release(&buf);
+}
+
+/**
+ * monitor_cur_dir_add - Watch the "cur" directory of the current Maildir
+ *
+ * The "new" directory is watched by the Mailbox's Monitor.
+ */
+static void monitor_cur_dir_add(void)
+{
+  struct Mailbox *m_cur = get_current_mailbox();
+  if (!m_cur || (m_cur->type != MUTT_MAILDIR) || (INotifyFd == -1) ||
+      (MonitorCurMboxCurDescriptor != -1))
+  {
+    return;
+  }
+
+  struct Buffer *path = buf_pool_get();
+  buf_printf(path, "%s/cur", m_cur->realpath);
+  MonitorCurMboxCurDescriptor = inotify_add_watch(INotifyFd, buf_string(path), INOTIFY_MASK_DIR);
+  if (MonitorCurMboxCurDescriptor == -1)
+  {
+    mutt_debug(LL_DEBUG2, "inotify_add_watch failed for '%s', errno=%d %s\n",
+               buf_string(path), errno, strerror(errno));
+  }
+  else
+  {
+    mutt_debug(LL_DEBUG3, "inotify_add_watch descriptor=%d for '%s'\n",
+               MonitorCurMboxCurDescriptor, buf_string(path));
+  }
+  buf_pool_release(&path);
+}
+
+/**
+ * monitor_cur_dir_remove - Stop watching the "cur" directory of the current Maildir
+ */
+static void monitor_cur_dir_remove(void)
+{
+  if ((MonitorCurMboxCurDescriptor != -1) && (INotifyFd != -1))
+  {
+    inotify_rm_watch(INotifyFd, MonitorCurMboxCurDescriptor);
+    mutt_debug(LL_DEBUG3, "inotify_rm_watch descriptor=%d\n", MonitorCurMboxCurDescriptor);
+  }
+  MonitorCurMboxCurDescriptor = -1;
+  mutt_monitor_events_clear();
+}
+
 /**
  * monitor_new - Create a new file monitor
  * @param info       Details of file to monitor
@@ -455,10 +558,30 @@ int mutt_monitor_poll(void)
                 event = (const struct inotify_event *) ptr;
                 mutt_debug(LL_DEBUG3, "+ detail: descriptor=%d mask=0x%x\n",
                            event->wd, event->mask);
-                if (event->mask & IN_IGNORED)
-                  monitor_handle_ignore(event->wd);
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                  /* events were dropped, the current mailbox must be rescanned */
+                  mutt_monitor_events_clear();
+                  MonitorCurMboxOverflow = true;
+                  MonitorCurMboxChanged = true;
+                }
+                else if (event->mask & IN_IGNORED)
+                {
+                  if (event->wd == MonitorCurMboxCurDescriptor)
+                    MonitorCurMboxCurDescriptor = -1;
+                  else
+                    monitor_handle_ignore(event->wd);
+                }
                 else if (event->wd == MonitorCurMboxDescriptor)
+                {
+                  monitor_event_add(event, "new");
                   MonitorCurMboxChanged = true;
+                }
+                else if ((event->wd == MonitorCurMboxCurDescriptor) && (event->wd != -1))
+                {
+                  monitor_event_add(event, "cur");
+                  MonitorCurMboxChanged = true;
+                }
                 ptr += sizeof(struct inotify_event) + event->len;
               }
             }
@@ -490,7 +613,10 @@ int mutt_monitor_add(struct Mailbox *m)
   if (desc != RESOLVE_RES_OK_NOTEXISTING)
   {
     if (!m && (desc == RESOLVE_RES_OK_EXISTING))
+    {
       MonitorCurMboxDescriptor = info.monitor->desc;
+      monitor_cur_dir_add();
+    }
     rc = (desc == RESOLVE_RES_OK_EXISTING) ? 0 : -1;
     goto cleanup;
   }
@@ -506,10 +632,13 @@ int mutt_monitor_add(struct Mailbox *m)
   }
 
   mutt_debug(LL_DEBUG3, "inotify_add_watch descriptor=%d for '%s'\n", desc, info.path);
+  monitor_new(&info, desc);
+
   if (!m)
+  {
     MonitorCurMboxDescriptor = desc;
-
-  monitor_new(&info, desc);
+    monitor_cur_dir_add();
+  }
 
 cleanup:
   monitor_info_free(&info);
@@ -535,6 +664,7 @@ int mutt_monitor_remove(struct Mailbox *m)
   {
     MonitorCurMboxDescriptor = -1;
     MonitorCurMboxChanged = false;
+    monitor_cur_dir_remove();
   }
 
   if (monitor_resolve(&info, m) != RESOLVE_RES_OK_EXISTING)
@@ -25,14 +25,29 @@
 #define MUTT_MONITOR_H
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "mutt/lib.h"
 
 struct Mailbox;
 
+/**
+ * struct MonitorEvent - A file that changed in the current Mailbox
+ */
+struct MonitorEvent
+{
+  char *name;    ///< File name, relative to the Mailbox, e.g. "new/1234.host"
+  uint32_t mask; ///< What happened, e.g. IN_MOVED_TO
+};
+ARRAY_HEAD(MonitorEventArray, struct MonitorEvent);
+
 extern bool MonitorFilesChanged;   ///< true after a monitored file has changed
 extern bool MonitorCurMboxChanged; ///< true after the current mailbox has changed
+extern bool MonitorCurMboxOverflow; ///< true if some changes to the current mailbox weren't recorded
+extern struct MonitorEventArray MonitorCurMboxEvents; ///< Changes to the files of the current mailbox
 
 int mutt_monitor_add(struct Mailbox *m);
 int mutt_monitor_remove(struct Mailbox *m);
 int mutt_monitor_poll(void);
+void mutt_monitor_events_clear(void);
 
 #endif /* MUTT_MONITOR_H */
@@ -566,6 +566,9 @@ static struct ConfigDef MainVars[] = {
   { "mail_check_stats_interval", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 60, 0, NULL,
     "How often to check for new mail"
   },
+  { "mail_check_timeout", DT_NUMBER|D_INTEGER_NOT_NEGATIVE, 250, 0, NULL,
+    "Maximum time (in milliseconds) to spend checking for new mail at once"
+  },
   { "mailcap_path", DT_SLIST|D_SLIST_SEP_COLON, IP "~/.mailcap:" PKGDATADIR "/mailcap:" SYSCONFDIR "/mailcap:/etc/mailcap:/usr/etc/mailcap:/usr/local/etc/mailcap", 0, NULL,
     "List of mailcap files (colon-separated)"
   },
@@ -587,6 +590,9 @@ static struct ConfigDef MainVars[] = {
   { "message_cache_dir", DT_PATH|D_PATH_DIR, 0, 0, NULL,
     "(imap/pop) Directory for the message cache"
   },
+  { "message_cache_size", DT_LONG|D_INTEGER_NOT_NEGATIVE, 0, 0, NULL,
+    "(imap/pop) Maximum size of the message cache for each mailbox, in bytes"
+  },
   { "message_format", DT_EXPANDO|D_NOT_EMPTY, IP "%s", IP &IndexFormatDef, NULL,
     "printf-like format string for listing attached messages"
   },
@@ -118,6 +118,7 @@ static bool label_message(struct Mailbox *m, struct Email *e, char *new_label)
 
   e->changed = true;
   e->env->changed |= MUTT_ENV_CHANGED_XLABEL;
+  e->score_gen = 0; // Score rules may depend on the label
   return true;
 }
 
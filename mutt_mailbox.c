@@ -45,6 +45,11 @@ static time_t MailboxTime = 0; ///< last time we started checking for mail
 static time_t MailboxStatsTime = 0; ///< last time we check performed mail_check_stats
 static short MailboxCount = 0;  ///< how many boxes with new mail
 static short MailboxNotify = 0; ///< # of unnotified new boxes
+static int MailboxPollNext = 0; ///< next mailbox to check, if a round was interrupted
+static CheckStatsFlags MailboxPollFlags = MUTT_MAILBOX_CHECK_NO_FLAGS; ///< flags of the interrupted round
+
+/// Maximum number of polling rounds to skip a slow mailbox
+#define MAILBOX_BACKOFF_MAX 32
 
 /**
  * is_same_mailbox - Compare two Mailboxes to see if they're equal
@@ -158,6 +163,26 @@ static void mailbox_check(struct Mailbox *m_cur, struct Mailbox *m_check,
   }
 }
 
+/**
+ * mailbox_poll_backoff - Check a Mailbox less often if it's slow
+ * @param m     Mailbox that was checked
+ * @param t     Time taken by the check, in milliseconds
+ * @param limit Time allowed for a check, in milliseconds
+ */
+static void mailbox_poll_backoff(struct Mailbox *m, uint64_t t, short limit)
+{
+  if ((limit == 0) || (t <= (uint64_t) limit))
+  {
+    m->poll_backoff = 0;
+    return;
+  }
+
+  m->poll_backoff = MIN(MAX(2 * m->poll_backoff, 1), MAILBOX_BACKOFF_MAX);
+  m->poll_skip = m->poll_backoff;
+  mutt_debug(LL_DEBUG1, "slow mailbox %s (%llu ms), skipping %d rounds\n",
+             mailbox_path(m), (unsigned long long) t, m->poll_skip);
+}
+
 /**
  * mutt_mailbox_check - Check all all Mailboxes for new mail
  * @param m_cur Current Mailbox
@@ -165,6 +190,10 @@ static void mailbox_check(struct Mailbox *m_cur, struct Mailbox *m_check,
  * @retval num Number of mailboxes with new mail
  *
  * Check all all Mailboxes for new mail and total/new/flagged messages
+ *
+ * A routine check stops after `$mail_check_timeout` milliseconds, to keep the
+ * UI responsive.  The next call continues where it left off.  Mailboxes that
+ * are slow to check are skipped for a few rounds.
  */
 int mutt_mailbox_check(struct Mailbox *m_cur, CheckStatsFlags flags)
 {
@@ -177,21 +206,36 @@ int mutt_mailbox_check(struct Mailbox *m_cur, CheckStatsFlags flags)
   const short c_mail_check = cs_subset_number(NeoMutt->sub, "mail_check");
   const bool c_mail_check_stats = cs_subset_bool(NeoMutt->sub, "mail_check_stats");
   const short c_mail_check_stats_interval = cs_subset_number(NeoMutt->sub, "mail_check_stats_interval");
+  const short c_mail_check_timeout = cs_subset_number(NeoMutt->sub, "mail_check_timeout");
 
-  time_t t = mutt_date_now();
-  if ((flags == MUTT_MAILBOX_CHECK_NO_FLAGS) && ((t - MailboxTime) < c_mail_check))
-    return MailboxCount;
+  /* An explicit request checks everything, however long it takes */
+  const bool full = (flags & (MUTT_MAILBOX_CHECK_STATS | MUTT_MAILBOX_CHECK_IMMEDIATE));
+  const short limit = full ? 0 : c_mail_check_timeout;
 
-  if ((flags & MUTT_MAILBOX_CHECK_STATS) ||
-      (c_mail_check_stats && ((t - MailboxStatsTime) >= c_mail_check_stats_interval)))
+  if (full)
+    MailboxPollNext = 0;
+
+  time_t t = mutt_date_now();
+  if (MailboxPollNext > 0)
   {
-    flags |= MUTT_MAILBOX_CHECK_STATS;
-    MailboxStatsTime = t;
+    /* Continue the interrupted round */
+    flags |= MailboxPollFlags;
   }
+  else
+  {
+    if ((flags == MUTT_MAILBOX_CHECK_NO_FLAGS) && ((t - MailboxTime) < c_mail_check))
+      return MailboxCount;
 
-  MailboxTime = t;
-  MailboxCount = 0;
-  MailboxNotify = 0;
+    if ((flags & MUTT_MAILBOX_CHECK_STATS) ||
+        (c_mail_check_stats && ((t - MailboxStatsTime) >= c_mail_check_stats_interval)))
+    {
+      flags |= MUTT_MAILBOX_CHECK_STATS;
+      MailboxStatsTime = t;
+    }
+
+    MailboxTime = t;
+    MailboxNotify = 0;
+  }
 
   /* check device ID and serial number instead of comparing paths */
   struct stat st_cur = { 0 };
@@ -202,6 +246,11 @@ int mutt_mailbox_check(struct Mailbox *m_cur, CheckStatsFlags flags)
     st_cur.st_ino = 0;
   }
 
+  const uint64_t t_start = mutt_date_now_ms();
+  int count = 0;
+  int index = 0;
+  bool interrupted = false;
+
   struct MailboxList ml = STAILQ_HEAD_INITIALIZER(ml);
   neomutt_mailboxlist_get_all(&ml, NeoMutt, MUTT_MAILBOX_ANY);
   struct MailboxNode *np = NULL;
@@ -212,18 +261,47 @@ int mutt_mailbox_check(struct Mailbox *m_cur, CheckStatsFlags flags)
     if (!m->visible || !m->poll_new_mail)
       continue;
 
-    CheckStatsFlags m_flags = flags;
-    if (!m->first_check_stats_done && c_mail_check_stats)
+    index++;
+    if ((index > MailboxPollNext) && !interrupted)
     {
-      m_flags |= MUTT_MAILBOX_CHECK_STATS;
+      uint64_t t_check = mutt_date_now_ms();
+      if ((limit > 0) && ((t_check - t_start) > (uint64_t) limit))
+      {
+        /* Out of time, leave the rest for next time */
+        MailboxPollNext = index - 1;
+        MailboxPollFlags = flags & MUTT_MAILBOX_CHECK_STATS;
+        interrupted = true;
+        mutt_debug(LL_DEBUG3, "out of time, %d mailboxes checked\n", MailboxPollNext);
+      }
+      else if (!full && (m->poll_skip > 0))
+      {
+        m->poll_skip--;
+      }
+      else
+      {
+        CheckStatsFlags m_flags = flags;
+        if (!m->first_check_stats_done && c_mail_check_stats)
+        {
+          m_flags |= MUTT_MAILBOX_CHECK_STATS;
+        }
+        mailbox_check(m_cur, m, &st_cur, m_flags);
+        m->first_check_stats_done = true;
+        mailbox_poll_backoff(m, mutt_date_now_ms() - t_check, c_mail_check_timeout);
+      }
     }
-    mailbox_check(m_cur, m, &st_cur, m_flags);
+
     if (m->has_new)
-      MailboxCount++;
-    m->first_check_stats_done = true;
+      count++;
   }
   neomutt_mailboxlist_clear(&ml);
 
+  if (!interrupted)
+  {
+    MailboxPollNext = 0;
+    MailboxPollFlags = MUTT_MAILBOX_CHECK_NO_FLAGS;
+  }
+
+  MailboxCount = count;
   return MailboxCount;
 }
 
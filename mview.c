@@ -192,6 +192,7 @@ void mview_update(struct MailboxView *mv)
       if (e2)
       {
         e2->superseded = true;
+        e2->score_gen = 0; // Force a full rescore
         if (c_score)
           mutt_score_message(mv->mailbox, e2, true);
       }
@@ -204,8 +205,12 @@ void mview_update(struct MailboxView *mv)
       mutt_hash_insert(m->subj_hash, e->env->real_subj, e);
     mutt_label_hash_add(m, e);
 
+    /* The flags, label or tags may have changed, which can affect any rule */
     if (c_score)
+    {
+      e->score_gen = 0; // Force a full rescore
       mutt_score_message(mv->mailbox, e, false);
+    }
 
     if (e->changed)
       m->changed = true;
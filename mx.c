@@ -1121,7 +1121,7 @@ enum MxStatus mx_mbox_check(struct Mailbox *m)
   m->last_checked = t;
 
   enum MxStatus rc = m->mx_ops->mbox_check(m);
-  if ((rc == MX_STATUS_NEW_MAIL) || (rc == MX_STATUS_REOPENED))
+  if ((rc == MX_STATUS_NEW_MAIL) || (rc == MX_STATUS_REOPENED) || (rc == MX_STATUS_BACKFILL))
   {
     mailbox_changed(m, NT_MAILBOX_INVALID);
   }
@@ -1302,7 +1302,10 @@ int mx_tags_commit(struct Mailbox *m, struct Email *e, const char *tags)
     return -1;
 
   if (m->mx_ops->tags_commit)
+  {
+    e->score_gen = 0; // Score rules may depend on the tags
     return m->mx_ops->tags_commit(m, e, tags);
+  }
 
   mutt_message(_("Folder doesn't support tagging, aborting"));
   return -1;
@@ -98,6 +98,7 @@ struct FetchCtx
   unsigned char *messages;
   struct Progress *progress;
   struct HeaderCache *hc;
+  FILE *fp; ///< Temporary file for parsing overview lines
 };
 
 /**
@@ -795,6 +796,81 @@ done:
   return rc;
 }
 
+/**
+ * nntp_read_lines - Read the lines of a multi-line answer
+ * @param mdata NNTP Mailbox data
+ * @param msg   Progress message (OPTIONAL)
+ * @param func  Callback function
+ * @param data  Data for callback function
+ * @retval  0 Success
+ * @retval -1 Connection lost
+ * @retval -2 Error in func(*line, *data)
+ *
+ * The status line of the answer must already have been read.
+ * This function calls func(*line, *data) for each received line,
+ * and func(NULL, *data) at the end.
+ */
+static int nntp_read_lines(struct NntpMboxData *mdata, const char *msg,
+                           int (*func)(char *, void *), void *data)
+{
+  char buf[1024] = { 0 };
+  unsigned int lines = 0;
+  size_t off = 0;
+  struct Progress *progress = NULL;
+  int rc = 0;
+
+  char *line = MUTT_MEM_MALLOC(sizeof(buf), char);
+
+  if (msg)
+  {
+    progress = progress_new(MUTT_PROGRESS_READ, 0);
+    progress_set_message(progress, "%s", msg);
+  }
+
+  while (true)
+  {
+    char *p = NULL;
+    int chunk = mutt_socket_readln_d(buf, sizeof(buf), mdata->adata->conn, MUTT_SOCK_LOG_FULL);
+    if (chunk < 0)
+    {
+      mdata->adata->status = NNTP_NONE;
+      rc = -1;
+      break;
+    }
+
+    p = buf;
+    if (!off && (buf[0] == '.'))
+    {
+      if (buf[1] == '\0')
+        break;
+      if (buf[1] == '.')
+        p++;
+    }
+
+    mutt_str_copy(line + off, p, sizeof(buf));
+
+    if (chunk >= sizeof(buf))
+    {
+      off += strlen(p);
+    }
+    else
+    {
+      progress_update(progress, ++lines, -1);
+
+      if ((rc == 0) && (func(line, data) < 0))
+        rc = -2;
+      off = 0;
+    }
+
+    MUTT_MEM_REALLOC(&line, off + sizeof(buf), char);
+  }
+  FREE(&line);
+  func(NULL, data);
+  progress_free(&progress);
+
+  return rc;
+}
+
 /**
  * nntp_fetch_lines - Read lines, calling a callback function for each
  * @param mdata NNTP Mailbox data
@@ -814,16 +890,11 @@ done:
 static int nntp_fetch_lines(struct NntpMboxData *mdata, char *query, size_t qlen,
                             const char *msg, int (*func)(char *, void *), void *data)
 {
-  bool done = false;
   int rc;
 
-  while (!done)
+  do
   {
     char buf[1024] = { 0 };
-    char *line = NULL;
-    unsigned int lines = 0;
-    size_t off = 0;
-    struct Progress *progress = NULL;
 
     mutt_str_copy(buf, query, sizeof(buf));
     if (nntp_query(mdata, buf, sizeof(buf)) < 0)
@@ -834,58 +905,9 @@ static int nntp_fetch_lines(struct NntpMboxData *mdata, char *query, size_t qlen
       return 1;
     }
 
-    line = MUTT_MEM_MALLOC(sizeof(buf), char);
-    rc = 0;
-
-    if (msg)
-    {
-      progress = progress_new(MUTT_PROGRESS_READ, 0);
-      progress_set_message(progress, "%s", msg);
-    }
-
-    while (true)
-    {
-      char *p = NULL;
-      int chunk = mutt_socket_readln_d(buf, sizeof(buf), mdata->adata->conn, MUTT_SOCK_LOG_FULL);
-      if (chunk < 0)
-      {
-        mdata->adata->status = NNTP_NONE;
-        break;
-      }
-
-      p = buf;
-      if (!off && (buf[0] == '.'))
-      {
-        if (buf[1] == '\0')
-        {
-          done = true;
-          break;
-        }
-        if (buf[1] == '.')
-          p++;
-      }
-
-      mutt_str_copy(line + off, p, sizeof(buf));
-
-      if (chunk >= sizeof(buf))
-      {
-        off += strlen(p);
-      }
-      else
-      {
-        progress_update(progress, ++lines, -1);
-
-        if ((rc == 0) && (func(line, data) < 0))
-          rc = -2;
-        off = 0;
-      }
-
-      MUTT_MEM_REALLOC(&line, off + sizeof(buf), char);
-    }
-    FREE(&line);
-    func(NULL, data);
-    progress_free(&progress);
-  }
+    /* if the connection is lost, try again */
+    rc = nntp_read_lines(mdata, msg, func, data);
+  } while (rc == -1);
 
   return rc;
 }
@@ -1080,60 +1102,20 @@ static int parse_overview_line(char *line, void *data)
     return 0;
   }
 
-  /* convert overview line to header */
-  FILE *fp = mutt_file_mkstemp();
-  if (!fp)
-    return -1;
-
-  header = mdata->adata->overview_fmt;
-  while (field)
-  {
-    char *b = field;
-
-    if (*header)
-    {
-      if (!strstr(header, ":full") && (fputs(header, fp) == EOF))
-      {
-        mutt_file_fclose(&fp);
-        return -1;
-      }
-      header = strchr(header, '\0') + 1;
-    }
-
-    field = strchr(field, '\t');
-    if (field)
-      *field++ = '\0';
-    if ((fputs(b, fp) == EOF) || (fputc('\n', fp) == EOF))
-    {
-      mutt_file_fclose(&fp);
-      return -1;
-    }
-  }
-  rewind(fp);
-
   /* allocate memory for headers */
   mx_alloc_memory(m, m->msg_count);
 
-  /* parse header */
-  m->emails[m->msg_count] = email_new();
-  e = m->emails[m->msg_count];
-  e->env = mutt_rfc822_read_header(fp, e, false, false);
-  e->env->newsgroups = mutt_str_dup(mdata->group);
-  e->received = e->date_sent;
-  mutt_file_fclose(&fp);
-
 #ifdef USE_HCACHE
+  char buf[16] = { 0 };
+  snprintf(buf, sizeof(buf), ANUM_FMT, anum);
+
+  /* prefer the header from cache, it doesn't need parsing */
   if (fc->hc)
   {
-    char buf[16] = { 0 };
-
-    /* try to replace with header from cache */
-    snprintf(buf, sizeof(buf), ANUM_FMT, anum);
     struct HCacheEntry hce = hcache_fetch_email(fc->hc, buf, strlen(buf), 0);
     if (hce.email)
     {
       mutt_debug(LL_DEBUG2, "hcache_fetch_email %s\n", buf);
-      email_free(&e);
       e = hce.email;
       m->emails[m->msg_count] = e;
       e->edata = NULL;
@@ -1151,14 +1133,61 @@ static int parse_overview_line(char *line, void *data)
         save = false;
       }
     }
+  }
+#endif
+
+  if (!e)
+  {
+    /* convert overview line to header, reusing the temporary file */
+    if (fc->fp)
+    {
+      if (!mutt_file_seek(fc->fp, 0, SEEK_SET) || (ftruncate(fileno(fc->fp), 0) != 0))
+        return -1;
+    }
     else
+    {
+      fc->fp = mutt_file_mkstemp();
+      if (!fc->fp)
+        return -1;
+    }
+    FILE *fp = fc->fp;
+
+    header = mdata->adata->overview_fmt;
+    while (field)
+    {
+      char *b = field;
+
+      if (*header)
+      {
+        if (!strstr(header, ":full") && (fputs(header, fp) == EOF))
+          return -1;
+        header = strchr(header, '\0') + 1;
+      }
+
+      field = strchr(field, '\t');
+      if (field)
+        *field++ = '\0';
+      if ((fputs(b, fp) == EOF) || (fputc('\n', fp) == EOF))
+        return -1;
+    }
+    rewind(fp);
+
+    /* parse header */
+    m->emails[m->msg_count] = email_new();
+    e = m->emails[m->msg_count];
+    e->env = mutt_rfc822_read_header(fp, e, false, false);
+    e->env->newsgroups = mutt_str_dup(mdata->group);
+    e->received = e->date_sent;
+
+#ifdef USE_HCACHE
+    if (fc->hc)
     {
       /* not cached yet, store header */
       mutt_debug(LL_DEBUG2, "hcache_store_email %s\n", buf);
       hcache_store_email(fc->hc, buf, strlen(buf), e, 0);
     }
-  }
 #endif
+  }
 
   if (save)
   {
@@ -1191,6 +1220,99 @@ static int parse_overview_line(char *line, void *data)
   return 0;
 }
 
+/**
+ * nntp_fetch_overview - Fetch the overview of a range of articles
+ * @param mdata NNTP Mailbox data
+ * @param fc    Fetch context
+ * @param first First article to fetch
+ * @param last  Last article to fetch
+ * @retval  0 Success
+ * @retval  1 Bad response
+ * @retval -1 Connection lost
+ * @retval -2 Error parsing an overview line
+ *
+ * A large range is split into several OVER commands.  A few of them are sent
+ * ahead, so the server doesn't have to wait for us between the answers.
+ * Ranges without any articles are skipped, and if the server says that a range
+ * is empty, that's not an error.
+ */
+static int nntp_fetch_overview(struct NntpMboxData *mdata, struct FetchCtx *fc,
+                               anum_t first, anum_t last)
+{
+  struct NntpAccountData *adata = mdata->adata;
+  const char *cmd = adata->hasOVER ? "OVER" : "XOVER";
+  char buf[1024] = { 0 };
+  int rc = 0;
+
+  /* a single command; let nntp_fetch_lines() deal with reconnecting */
+  if (((last - first) < NNTP_OVER_CHUNK) || (adata->status != NNTP_OK))
+  {
+    snprintf(buf, sizeof(buf), "%s " ANUM_FMT "-" ANUM_FMT "\r\n", cmd, first, last);
+    rc = nntp_fetch_lines(mdata, buf, sizeof(buf), NULL, parse_overview_line, fc);
+    if (rc > 0)
+      mutt_error("%s: %s", cmd, buf);
+    return rc;
+  }
+
+  anum_t next = first; // first article that hasn't been requested
+  int pending = 0;     // number of answers waiting to be read
+  while ((rc == 0) && ((next <= last) || (pending > 0)))
+  {
+    for (; (next <= last) && (pending < NNTP_PIPELINE_DEPTH); pending++)
+    {
+      /* skip the numbers with no articles, e.g. expired ones */
+      while ((next <= last) && !fc->messages[next - fc->first])
+        next++;
+      if (next > last)
+        break;
+
+      anum_t end = MIN(next + NNTP_OVER_CHUNK - 1, last);
+      snprintf(buf, sizeof(buf), "%s " ANUM_FMT "-" ANUM_FMT "\r\n", cmd, next, end);
+      if (mutt_socket_send(adata->conn, buf) < 0)
+      {
+        rc = -1;
+        break;
+      }
+      next = end + 1;
+    }
+    if ((rc != 0) || (pending == 0))
+      break;
+
+    if (mutt_socket_readln(buf, sizeof(buf), adata->conn) < 0)
+    {
+      rc = -1;
+      break;
+    }
+    pending--;
+
+    /* no articles in this range */
+    if (mutt_str_startswith(buf, "423") || mutt_str_startswith(buf, "420"))
+      continue;
+
+    if (buf[0] != '2')
+    {
+      mutt_error("%s: %s", cmd, buf);
+      rc = 1;
+      break;
+    }
+
+    rc = nntp_read_lines(mdata, NULL, parse_overview_line, fc);
+  }
+
+  /* Unread answers may still be in flight; reconnect next time */
+  if ((rc != 0) && (adata->status == NNTP_OK) && (pending > 0))
+  {
+    mutt_socket_close(adata->conn);
+    adata->status = NNTP_NONE;
+  }
+  else if (rc == -1)
+  {
+    adata->status = NNTP_NONE;
+  }
+
+  return rc;
+}
+
 /**
  * nntp_fetch_headers - Fetch headers
  * @param m       Mailbox
@@ -1412,16 +1534,9 @@ static int nntp_fetch_headers(struct Mailbox *m, void *hc, anum_t first, anum_t
 
   /* fetch overview information */
   if ((current <= last) && (rc == 0) && !mdata->deleted)
-  {
-    char *cmd = mdata->adata->hasOVER ? "OVER" : "XOVER";
-    snprintf(buf, sizeof(buf), "%s " ANUM_FMT "-" ANUM_FMT "\r\n", cmd, current, last);
-    rc = nntp_fetch_lines(mdata, buf, sizeof(buf), NULL, parse_overview_line, &fc);
-    if (rc > 0)
-    {
-      mutt_error("%s: %s", cmd, buf);
-    }
-  }
+    rc = nntp_fetch_overview(mdata, &fc, current, last);
 
+  mutt_file_fclose(&fc.fp);
   FREE(&fc.messages);
   progress_free(&fc.progress);
   if (rc != 0)
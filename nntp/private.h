@@ -36,6 +36,11 @@ struct NntpMboxData;
 #define NNTP_PORT 119
 #define NNTP_SSL_PORT 563
 
+/* number of articles to request in each OVER command */
+#define NNTP_OVER_CHUNK 5000
+/* number of OVER commands to send ahead of reading the answers */
+#define NNTP_PIPELINE_DEPTH 4
+
 /**
  * enum NntpStatus - NNTP server return values
  */
@@ -42,6 +42,8 @@ struct NmMboxData
   int oldmsgcount;
   int ignmsgcount;             ///< Ignored messages
   struct timespec mtime;       ///< Time Mailbox was last changed
+  unsigned long lastmod;       ///< Database revision when the Mailbox was last read
+  char *lastmod_uuid;          ///< Database UUID that the revision belongs to
 };
 
 void                  nm_mdata_free(void **ptr);
@@ -57,6 +57,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
 #include <time.h>
 #include <unistd.h>
 #include "private.h"
@@ -85,8 +86,6 @@
 #include <libintl.h>
 #endif
 
-struct stat;
-
 /**
  * NmCommands - Notmuch Commands
  */
@@ -758,6 +757,101 @@ static struct Email *get_mutt_email(struct Mailbox *m, notmuch_message_t *msg)
   return e;
 }
 
+/**
+ * parse_message - Parse a message file that isn't in the header cache
+ * @param[in]  hc      Header cache handle
+ * @param[in]  path    Filename from the Notmuch database
+ * @param[out] newpath Filename, if the message has been moved
+ * @retval ptr  New Email
+ * @retval NULL Error
+ */
+static struct Email *parse_message(struct HeaderCache *hc, const char *path, char **newpath)
+{
+  struct Email *e = NULL;
+
+  if (access(path, F_OK) == 0)
+  {
+    /* We pass is_old=false as argument here, but e->old will be updated later
+     * by update_message_path() (called by init_email() below).  */
+    e = maildir_email_new();
+    if (!maildir_parse_message(path, false, e))
+      email_free(&e);
+  }
+  else
+  {
+    /* maybe moved try find it... */
+    char *folder = get_folder_from_path(path);
+
+    if (folder)
+    {
+      FILE *fp = maildir_open_find_message(folder, path, newpath);
+      if (fp)
+      {
+        e = maildir_email_new();
+        if (!maildir_parse_stream(fp, *newpath, false, e))
+          email_free(&e);
+        mutt_file_fclose(&fp);
+
+        mutt_debug(LL_DEBUG1, "nm: not up-to-date: %s -> %s\n", path, *newpath);
+      }
+    }
+    FREE(&folder);
+  }
+
+  if (!e)
+  {
+    mutt_debug(LL_DEBUG1, "nm: failed to parse message: %s\n", path);
+    return NULL;
+  }
+
+#ifdef USE_HCACHE
+  hcache_store_email(hc, *newpath ? *newpath : path,
+                     mutt_str_len(*newpath ? *newpath : path), e, 0);
+#endif
+  return e;
+}
+
+/**
+ * add_email - Add an Email to the Mailbox
+ * @param m       Mailbox
+ * @param e       Email, will be freed on failure
+ * @param msg     Notmuch message
+ * @param path    Filename from the Notmuch database
+ * @param newpath Filename, if the message has been moved
+ * @retval true Success
+ *
+ * @note The caller must have allocated space for the Email
+ */
+static bool add_email(struct Mailbox *m, struct Email *e, notmuch_message_t *msg,
+                      const char *path, const char *newpath)
+{
+  if (init_email(e, newpath ? newpath : path, msg) != 0)
+  {
+    email_free(&e);
+    mutt_debug(LL_DEBUG1, "nm: failed to append email!\n");
+    return false;
+  }
+
+  e->active = true;
+  e->index = m->msg_count;
+  mailbox_size_add(m, e);
+  m->emails[m->msg_count] = e;
+  m->msg_count++;
+
+  if (newpath)
+  {
+    /* remember that file has been moved -- nm_mbox_sync() will update the DB */
+    struct NmEmailData *edata = nm_edata_get(e);
+    if (edata)
+    {
+      mutt_debug(LL_DEBUG1, "nm: remember obsolete path: %s\n", path);
+      edata->oldpath = mutt_str_dup(path);
+    }
+  }
+  nm_progress_update(m);
+  return true;
+}
+
 /**
  * append_message - Associate a message
  * @param hc    Header cache handle
@@ -799,72 +893,12 @@ static void append_message(struct HeaderCache *hc, struct Mailbox *m,
   if (!e)
 #endif
   {
-    if (access(path, F_OK) == 0)
-    {
-      /* We pass is_old=false as argument here, but e->old will be updated later
-       * by update_message_path() (called by init_email() below).  */
-      e = maildir_email_new();
-      if (!maildir_parse_message(path, false, e))
-        email_free(&e);
-    }
-    else
-    {
-      /* maybe moved try find it... */
-      char *folder = get_folder_from_path(path);
-
-      if (folder)
-      {
-        FILE *fp = maildir_open_find_message(folder, path, &newpath);
-        if (fp)
-        {
-          e = maildir_email_new();
-          if (!maildir_parse_stream(fp, newpath, false, e))
-            email_free(&e);
-          mutt_file_fclose(&fp);
-
-          mutt_debug(LL_DEBUG1, "nm: not up-to-date: %s -> %s\n", path, newpath);
-        }
-      }
-      FREE(&folder);
-    }
-
-    if (!e)
-    {
-      mutt_debug(LL_DEBUG1, "nm: failed to parse message: %s\n", path);
-      goto done;
-    }
-
-#ifdef USE_HCACHE
-    hcache_store_email(hc, newpath ? newpath : path,
-                       mutt_str_len(newpath ? newpath : path), e, 0);
-#endif
-  }
-
-  if (init_email(e, newpath ? newpath : path, msg) != 0)
-  {
-    email_free(&e);
-    mutt_debug(LL_DEBUG1, "nm: failed to append email!\n");
-    goto done;
+    e = parse_message(hc, path, &newpath);
   }
 
-  e->active = true;
-  e->index = m->msg_count;
-  mailbox_size_add(m, e);
-  m->emails[m->msg_count] = e;
-  m->msg_count++;
+  if (e)
+    add_email(m, e, msg, path, newpath);
 
-  if (newpath)
-  {
-    /* remember that file has been moved -- nm_mbox_sync() will update the DB */
-    struct NmEmailData *edata = nm_edata_get(e);
-    if (edata)
-    {
-      mutt_debug(LL_DEBUG1, "nm: remember obsolete path: %s\n", path);
-      edata->oldpath = mutt_str_dup(path);
-    }
-  }
-  nm_progress_update(m);
-done:
   FREE(&newpath);
 }
 
@@ -949,6 +983,122 @@ static notmuch_messages_t *get_messages(notmuch_query_t *query)
   return msgs;
 }
 
+/**
+ * struct NmLoad - A message waiting to be loaded
+ */
+struct NmLoad
+{
+  notmuch_message_t *msg; ///< Notmuch message
+  const char *path;       ///< Filename from the Notmuch database
+  char *newpath;          ///< Filename, if the message has been moved
+  ino_t inode;            ///< Inode number of the file
+  struct Email *email;    ///< Email, once loaded
+};
+ARRAY_HEAD(NmLoadArray, struct NmLoad);
+ARRAY_HEAD(NmLoadPtrArray, struct NmLoad *);
+
+/**
+ * nm_load_sort_inode - Compare two NmLoads by inode number - Implements ::sort_t - @ingroup sort_api
+ */
+static int nm_load_sort_inode(const void *a, const void *b, void *sdata)
+{
+  const struct NmLoad *la = *(struct NmLoad **) a;
+  const struct NmLoad *lb = *(struct NmLoad **) b;
+
+  return mutt_numeric_cmp(la->inode, lb->inode);
+}
+
+/**
+ * nm_load_free - Free an array of NmLoads
+ * @param nla Array to free
+ */
+static void nm_load_free(struct NmLoadArray *nla)
+{
+  struct NmLoad *nl = NULL;
+  ARRAY_FOREACH(nl, nla)
+  {
+    email_free(&nl->email);
+    FREE(&nl->newpath);
+    notmuch_message_destroy(nl->msg);
+  }
+  ARRAY_FREE(nla);
+}
+
+/**
+ * load_messages - Load a batch of messages into the Mailbox
+ * @param m   Mailbox
+ * @param nla Messages to load
+ * @retval true  Success
+ * @retval false Aborted by the user
+ *
+ * Rather than alternating between the header cache and the mail files for
+ * every message, look up all the messages in the header cache first.  The
+ * files that weren't cached are then parsed in inode order, which keeps the
+ * disk seeks down.  Finally, the Emails are added in the order of the query.
+ */
+static bool load_messages(struct Mailbox *m, struct NmLoadArray *nla)
+{
+  struct NmMboxData *mdata = nm_mdata_get(m);
+  struct NmLoad *nl = NULL;
+  int loaded = 0;
+  bool rc = false;
+
+  struct HeaderCache *hc = nm_hcache_open(m);
+
+  struct NmLoadPtrArray parse = ARRAY_HEAD_INITIALIZER;
+  ARRAY_FOREACH(nl, nla)
+  {
+#ifdef USE_HCACHE
+    nl->email = hcache_fetch_email(hc, nl->path, mutt_str_len(nl->path), 0).email;
+#endif
+    if (nl->email)
+    {
+      loaded++;
+      continue;
+    }
+
+    struct stat st = { 0 };
+    if (stat(nl->path, &st) == 0)
+      nl->inode = st.st_ino;
+    ARRAY_ADD(&parse, nl);
+  }
+
+  mutt_debug(LL_DEBUG2, "nm: %d cached, %d to parse\n", loaded, ARRAY_SIZE(&parse));
+  ARRAY_SORT(&parse, nm_load_sort_inode, NULL);
+
+  struct NmLoad **nlp = NULL;
+  ARRAY_FOREACH(nlp, &parse)
+  {
+    if (SigInt)
+    {
+      SigInt = false;
+      goto done;
+    }
+
+    nl = *nlp;
+    nl->email = parse_message(hc, nl->path, &nl->newpath);
+    loaded++;
+    if (m->verbose && mdata->progress)
+      progress_update(mdata->progress, m->msg_count + mdata->ignmsgcount + loaded, -1);
+  }
+
+  mx_alloc_memory(m, m->msg_count + ARRAY_SIZE(nla));
+  ARRAY_FOREACH(nl, nla)
+  {
+    if (!nl->email)
+      continue;
+
+    add_email(m, nl->email, nl->msg, nl->path, nl->newpath);
+    nl->email = NULL;
+  }
+  rc = true;
+
+done:
+  ARRAY_FREE(&parse);
+  nm_hcache_close(&hc);
+  return rc;
+}
+
 /**
  * read_mesgs_query - Search for matching messages
  * @param m     Mailbox
@@ -970,24 +1120,47 @@ static bool read_mesgs_query(struct Mailbox *m, notmuch_query_t *q, bool dedup)
   if (!msgs)
     return false;
 
-  struct HeaderCache *hc = nm_hcache_open(m);
+  bool rc = false;
+  struct NmLoadArray nla = ARRAY_HEAD_INITIALIZER;
 
-  for (; notmuch_messages_valid(msgs) && ((limit == 0) || (m->msg_count < limit));
+  for (; notmuch_messages_valid(msgs) &&
+         ((limit == 0) || ((m->msg_count + ARRAY_SIZE(&nla)) < limit));
        notmuch_messages_move_to_next(msgs))
   {
     if (SigInt)
     {
-      nm_hcache_close(&hc);
       SigInt = false;
-      return false;
+      goto done;
     }
     notmuch_message_t *nm = notmuch_messages_get(msgs);
-    append_message(hc, m, nm, dedup);
-    notmuch_message_destroy(nm);
+
+    /* deduplicate */
+    if (dedup && get_mutt_email(m, nm))
+    {
+      mdata->ignmsgcount++;
+      nm_progress_update(m);
+      mutt_debug(LL_DEBUG2, "nm: ignore id=%s, already in the m\n",
+                 notmuch_message_get_message_id(nm));
+      notmuch_message_destroy(nm);
+      continue;
+    }
+
+    const char *path = get_message_last_filename(nm);
+    if (!path)
+    {
+      notmuch_message_destroy(nm);
+      continue;
+    }
+
+    struct NmLoad nl = { .msg = nm, .path = path };
+    ARRAY_ADD(&nla, nl);
   }
 
-  nm_hcache_close(&hc);
-  return true;
+  rc = load_messages(m, &nla);
+
+done:
+  nm_load_free(&nla);
+  return rc;
 }
 
 /**
@@ -2060,6 +2233,38 @@ static bool nm_ac_add(struct Account *a, struct Mailbox *m)
   return true;
 }
 
+/**
+ * get_revision - Get the revision of the Notmuch database
+ * @param[in]  m    Mailbox
+ * @param[out] uuid UUID of the database, the revision is only valid for it
+ * @retval num Revision, 0 if unsupported
+ *
+ * Every change to the database gets a new revision number, which is stored
+ * in the changed messages (lastmod).
+ */
+static unsigned long get_revision(struct Mailbox *m, const char **uuid)
+{
+  *uuid = NULL;
+#if LIBNOTMUCH_CHECK_VERSION(4, 3, 0)
+  notmuch_database_t *db = nm_db_get(m, false);
+  if (db)
+    return notmuch_database_get_revision(db, uuid);
+#endif
+  return 0;
+}
+
+/**
+ * set_revision - Remember which database revision the Mailbox reflects
+ * @param mdata Notmuch Mailbox data
+ * @param rev   Revision
+ * @param uuid  UUID of the database
+ */
+static void set_revision(struct NmMboxData *mdata, unsigned long rev, const char *uuid)
+{
+  mdata->lastmod = rev;
+  mutt_str_replace(&mdata->lastmod_uuid, uuid);
+}
+
 /**
  * nm_mbox_open - Open a Mailbox - Implements MxOps::mbox_open() - @ingroup mx_mbox_open
  */
@@ -2080,6 +2285,10 @@ static enum MxOpenReturns nm_mbox_open(struct Mailbox *m)
   notmuch_query_t *q = get_query(m, false);
   if (q)
   {
+    const char *uuid = NULL;
+    const unsigned long rev = get_revision(m, &uuid);
+    set_revision(mdata, rev, uuid);
+
     rc = MX_OPEN_OK;
     switch (mdata->query_type)
     {
@@ -2108,6 +2317,153 @@ static enum MxOpenReturns nm_mbox_open(struct Mailbox *m)
   return rc;
 }
 
+/**
+ * merge_email - Update an Email from its Notmuch message
+ * @param m   Mailbox
+ * @param e   Email
+ * @param msg Notmuch message
+ * @retval true The Email's tags changed
+ */
+static bool merge_email(struct Mailbox *m, struct Email *e, notmuch_message_t *msg)
+{
+  /* Check to see if the message has moved to a different subdirectory.
+   * If so, update the associated filename.  */
+  const char *new_file = get_message_last_filename(msg);
+  char old_file[PATH_MAX] = { 0 };
+  email_get_fullpath(e, old_file, sizeof(old_file));
+
+  if (!mutt_str_equal(old_file, new_file))
+    update_message_path(e, new_file);
+
+  if (!e->changed)
+  {
+    /* if the user hasn't modified the flags on this message, update the
+     * flags we just detected.  */
+    struct Email *e_tmp = maildir_email_new();
+    maildir_parse_flags(e_tmp, new_file);
+    e_tmp->old = e->old;
+    maildir_update_flags(m, e, e_tmp);
+    email_free(&e_tmp);
+  }
+
+  return (update_email_tags(e, msg) == 0);
+}
+
+/**
+ * check_lastmod - Apply the changes made to the database since the last check
+ * @param[in]  m         Mailbox
+ * @param[in]  rev       Current database revision
+ * @param[in]  uuid      Current database UUID
+ * @param[out] new_flags Incremented for each Email whose tags changed
+ * @param[out] occult    Set to true if Emails have left the Mailbox
+ * @retval true  Success
+ * @retval false A full check is needed
+ *
+ * Rather than walking every message of the query, only look at the messages
+ * whose lastmod is newer than the last check.
+ */
+static bool check_lastmod(struct Mailbox *m, unsigned long rev, const char *uuid,
+                          int *new_flags, bool *occult)
+{
+  struct NmMboxData *mdata = nm_mdata_get(m);
+
+  /* Threads, limits and windows can change the results without touching
+   * the messages themselves */
+  if ((mdata->lastmod == 0) || (rev < mdata->lastmod) ||
+      !mutt_str_equal(uuid, mdata->lastmod_uuid) ||
+      (mdata->query_type == NM_QUERY_TYPE_THREADS) || (get_limit(mdata) != 0) ||
+      nm_query_window_available())
+  {
+    return false;
+  }
+
+  notmuch_database_t *db = nm_db_get(m, false);
+  const char *str = get_query_string(mdata, false);
+  if (!db || !str)
+    return false;
+
+  bool rc = false;
+  notmuch_query_t *q = NULL;
+  struct HeaderCache *hc = NULL;
+  struct Buffer *qstr = buf_pool_get();
+  // Hash Table: "notmuch message-id" -> Email, changed messages that still match
+  struct HashTable *matched = mutt_hash_new(64, MUTT_HASH_NO_FLAGS);
+
+  /* Changed messages that match the query */
+  buf_printf(qstr, "(%s) and lastmod:%lu..%lu", str, mdata->lastmod + 1, rev);
+  q = notmuch_query_create(db, buf_string(qstr));
+  if (!q)
+    goto done;
+  apply_exclude_tags(q);
+
+  notmuch_messages_t *msgs = get_messages(q);
+  if (!msgs)
+    goto done;
+
+  hc = nm_hcache_open(m);
+  for (; notmuch_messages_valid(msgs); notmuch_messages_move_to_next(msgs))
+  {
+    notmuch_message_t *msg = notmuch_messages_get(msgs);
+    struct Email *e = get_mutt_email(m, msg);
+    if (e)
+    {
+      e->active = true;
+      if (merge_email(m, e, msg))
+        (*new_flags)++;
+      mutt_hash_insert(matched, nm_edata_get(e)->virtual_id, e);
+    }
+    else
+    {
+      append_message(hc, m, msg, false);
+    }
+    notmuch_message_destroy(msg);
+  }
+  nm_hcache_close(&hc);
+  notmuch_query_destroy(q);
+
+  /* Changed messages that don't match any more */
+  buf_printf(qstr, "lastmod:%lu..%lu", mdata->lastmod + 1, rev);
+  q = notmuch_query_create(db, buf_string(qstr));
+  if (!q)
+    goto done;
+
+  msgs = get_messages(q);
+  if (!msgs)
+    goto done;
+
+  for (; notmuch_messages_valid(msgs); notmuch_messages_move_to_next(msgs))
+  {
+    notmuch_message_t *msg = notmuch_messages_get(msgs);
+    struct Email *e = get_mutt_email(m, msg);
+    if (e && e->active && !mutt_hash_find(matched, nm_edata_get(e)->virtual_id))
+    {
+      e->active = false;
+      *occult = true;
+    }
+    notmuch_message_destroy(msg);
+  }
+
+  /* Messages removed from the database don't have a lastmod.
+   * Make sure the counts still agree. */
+  unsigned int active = 0;
+  for (int i = 0; i < m->msg_count; i++)
+  {
+    if (m->emails[i] && m->emails[i]->active)
+      active++;
+  }
+  const unsigned int count = count_query(db, str, 0);
+  rc = (count == active);
+  if (!rc)
+    mutt_debug(LL_DEBUG1, "nm: lastmod: counts differ (db=%u mailbox=%u)\n", count, active);
+
+done:
+  if (q)
+    notmuch_query_destroy(q);
+  mutt_hash_free(&matched);
+  buf_pool_release(&qstr);
+  return rc;
+}
+
 /**
  * nm_mbox_check - Check for new mail - Implements MxOps::mbox_check() - @ingroup mx_mbox_check
  * @param m Mailbox
@@ -2133,12 +2489,29 @@ static enum MxStatus nm_mbox_check(struct Mailbox *m)
   mutt_debug(LL_DEBUG1, "nm: checking (db=%llu mailbox=%llu)\n",
              (unsigned long long) mtime, (unsigned long long) mdata->mtime.tv_sec);
 
-  notmuch_query_t *q = get_query(m, false);
+  mdata->oldmsgcount = m->msg_count;
+
+  const char *uuid = NULL;
+  const unsigned long rev = get_revision(m, &uuid);
+  notmuch_query_t *q = NULL;
+
+  if (check_lastmod(m, rev, uuid, &new_flags, &occult))
+  {
+    mutt_debug(LL_DEBUG1, "nm: lastmod %lu..%lu applied\n", mdata->lastmod, rev);
+    set_revision(mdata, rev, uuid);
+    if (m->msg_count > mdata->oldmsgcount)
+      mailbox_changed(m, NT_MAILBOX_INVALID);
+    goto done;
+  }
+  new_flags = 0;
+  occult = false;
+  set_revision(mdata, rev, uuid);
+
+  q = get_query(m, false);
   if (!q)
     goto done;
 
   mutt_debug(LL_DEBUG1, "nm: start checking (count=%d)\n", m->msg_count);
-  mdata->oldmsgcount = m->msg_count;
 
   for (int i = 0; i < m->msg_count; i++)
   {
@@ -2180,28 +2553,7 @@ static enum MxStatus nm_mbox_check(struct Mailbox *m)
 
     /* message already exists, merge flags */
     e->active = true;
-
-    /* Check to see if the message has moved to a different subdirectory.
-     * If so, update the associated filename.  */
-    const char *new_file = get_message_last_filename(msg);
-    char old_file[PATH_MAX] = { 0 };
-    email_get_fullpath(e, old_file, sizeof(old_file));
-
-    if (!mutt_str_equal(old_file, new_file))
-      update_message_path(e, new_file);
-
-    if (!e->changed)
-    {
-      /* if the user hasn't modified the flags on this message, update the
-       * flags we just detected.  */
-      struct Email *e_tmp = maildir_email_new();
-      maildir_parse_flags(e_tmp, new_file);
-      e_tmp->old = e->old;
-      maildir_update_flags(m, e, e_tmp);
-      email_free(&e_tmp);
-    }
-
-    if (update_email_tags(e, msg) == 0)
+    if (merge_email(m, e, msg))
       new_flags++;
 
     notmuch_message_destroy(msg);
@@ -392,6 +392,8 @@ static void match_body_patterns(char *pat, struct Line *lines, int line_num)
   STAILQ_FOREACH(color_line, head, entries)
   {
     color_line->stop_matching = false;
+    color_line->next_match.rm_so = -1;
+    color_line->next_match.rm_eo = -1;
   }
 
   do
@@ -410,15 +412,24 @@ static void match_body_patterns(char *pat, struct Line *lines, int line_num)
       if (color_line->stop_matching)
         continue;
 
-      if ((regexec(&color_line->regex, pat + offset, 1, pmatch,
-                   ((offset != 0) ? REG_NOTBOL : 0)) != 0))
+      /* A match that starts beyond the current offset is still the next one,
+       * so only search again if the previous chunk overlapped it. */
+      if (color_line->next_match.rm_so < offset)
       {
-        /* Once a regex fails to match, don't try matching it again.
-         * On very long lines this can cause a performance issue if there
-         * are other regexes that have many matches. */
-        color_line->stop_matching = true;
-        continue;
+        if ((regexec(&color_line->regex, pat + offset, 1, pmatch,
+                     ((offset != 0) ? REG_NOTBOL : 0)) != 0))
+        {
+          /* Once a regex fails to match, don't try matching it again.
+           * On very long lines this can cause a performance issue if there
+           * are other regexes that have many matches. */
+          color_line->stop_matching = true;
+          continue;
+        }
+
+        color_line->next_match.rm_so = pmatch[0].rm_so + offset;
+        color_line->next_match.rm_eo = pmatch[0].rm_eo + offset;
       }
+      pmatch[0] = color_line->next_match;
 
       if (pmatch[0].rm_eo == pmatch[0].rm_so)
       {
@@ -445,8 +456,6 @@ static void match_body_patterns(char *pat, struct Line *lines, int line_num)
         }
       }
       i = lines[line_num].syntax_arr_size - 1;
-      pmatch[0].rm_so += offset;
-      pmatch[0].rm_eo += offset;
 
       if (!found || (pmatch[0].rm_so < (lines[line_num].syntax)[i].first) ||
           ((pmatch[0].rm_so == (lines[line_num].syntax)[i].first) &&
@@ -353,7 +353,12 @@ int dlg_pager(struct PagerView *pview)
   //---------- show windows, set focus and visibility --------------------------
   window_set_visible(pview->win_pager->parent, true);
   mutt_window_reflow(dlg);
-  window_invalidate_all();
+  // Repaint the dialog, but let curses only send the changes to the terminal,
+  // unless another program may have written to it
+  if (pview->flags & MUTT_PAGER_CLEAR)
+    window_invalidate_all();
+  else
+    window_invalidate(dlg);
 
   struct MuttWindow *old_focus = window_set_focus(pview->win_pager);
 
@@ -568,6 +568,27 @@ static int op_pager_prev_page(struct IndexSharedData *shared,
   return FR_SUCCESS;
 }
 
+/**
+ * pager_search_line - Find the search matches in a line of the Pager
+ * @param priv     Private Pager data
+ * @param line_num Line number
+ * @retval true  The line exists
+ * @retval false End of the message
+ *
+ * Lines are only laid out, and searched, when a search reaches them.
+ */
+static bool pager_search_line(struct PagerPrivateData *priv, int line_num)
+{
+  if (line_num > priv->lines_used)
+    return false;
+
+  return display_line(priv->fp, &priv->bytes_read, &priv->lines, line_num,
+                      &priv->lines_used, &priv->lines_max,
+                      MUTT_SEARCH | (priv->pview->flags & MUTT_PAGER_NOWRAP) | priv->has_types,
+                      &priv->quote_list, &priv->q_level, &priv->force_redraw,
+                      &priv->search_re, priv->pview->win_pager, &priv->ansi_list) == 0;
+}
+
 /**
  * op_pager_search - Search for a regular expression - Implements ::pager_function_t - @ingroup pager_function_api
  *
@@ -578,8 +599,6 @@ static int op_pager_prev_page(struct IndexSharedData *shared,
 static int op_pager_search(struct IndexSharedData *shared,
                            struct PagerPrivateData *priv, int op)
 {
-  struct PagerView *pview = priv->pview;
-
   int rc = FR_NO_ACTION;
   struct Buffer *buf = buf_pool_get();
 
@@ -644,16 +663,6 @@ static int op_pager_search(struct IndexSharedData *shared,
   else
   {
     priv->search_compiled = true;
-    /* update the search pointers */
-    int line_num = 0;
-    while (display_line(priv->fp, &priv->bytes_read, &priv->lines, line_num,
-                        &priv->lines_used, &priv->lines_max,
-                        MUTT_SEARCH | (pview->flags & MUTT_PAGER_NOWRAP) | priv->has_types,
-                        &priv->quote_list, &priv->q_level, &priv->force_redraw,
-                        &priv->search_re, priv->pview->win_pager, &priv->ansi_list) == 0)
-    {
-      line_num++;
-    }
 
     if (priv->search_back)
     {
@@ -661,6 +670,7 @@ static int op_pager_search(struct IndexSharedData *shared,
       int i;
       for (i = priv->top_line; i >= 0; i--)
       {
+        pager_search_line(priv, i);
         if ((!priv->hide_quoted || !COLOR_QUOTED(priv->lines[i].cid)) &&
             !priv->lines[i].cont_line && (priv->lines[i].search_arr_size > 0))
         {
@@ -673,9 +683,9 @@ static int op_pager_search(struct IndexSharedData *shared,
     }
     else
     {
-      /* searching forward */
+      /* searching forward, only reading as far as the first match */
       int i;
-      for (i = priv->top_line; i < priv->lines_used; i++)
+      for (i = priv->top_line; pager_search_line(priv, i); i++)
       {
         if ((!priv->hide_quoted || !COLOR_QUOTED(priv->lines[i].cid)) &&
             !priv->lines[i].cont_line && (priv->lines[i].search_arr_size > 0))
@@ -742,7 +752,7 @@ static int op_pager_search_next(struct IndexSharedData *shared,
       /* searching forward */
       int i;
       for (i = priv->wrapped ? 0 : priv->top_line + priv->searchctx + 1;
-           i < priv->lines_used; i++)
+           pager_search_line(priv, i); i++)
       {
         if ((!priv->hide_quoted || !COLOR_QUOTED(priv->lines[i].cid)) &&
             !priv->lines[i].cont_line && (priv->lines[i].search_arr_size > 0))
@@ -770,10 +780,18 @@ static int op_pager_search_next(struct IndexSharedData *shared,
     else
     {
       /* searching backward */
+      if (priv->wrapped)
+      {
+        /* the search continues from the bottom, so read the rest of the message */
+        while (pager_search_line(priv, priv->lines_used))
+          ; // do nothing
+      }
+
       int i;
       for (i = priv->wrapped ? priv->lines_used : priv->top_line + priv->searchctx - 1;
            i >= 0; i--)
       {
+        pager_search_line(priv, i);
         if ((!priv->hide_quoted ||
              (priv->has_types && !COLOR_QUOTED(priv->lines[i].cid))) &&
             !priv->lines[i].cont_line && (priv->lines[i].search_arr_size > 0))
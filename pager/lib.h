@@ -72,6 +72,7 @@ typedef uint16_t PagerFlags;              ///< Flags for dlg_pager(), e.g. #MUTT
 #define MUTT_PAGER_LOGS       (1 << 8)    ///< Logview mode
 #define MUTT_PAGER_BOTTOM     (1 << 9)    ///< Start at the bottom
 #define MUTT_PAGER_STRIPES    (1 << 10)   ///< Striped highlighting
+#define MUTT_PAGER_CLEAR      (1 << 11)   ///< Clear the screen, an external program may have used it
 #define MUTT_PAGER_MESSAGE    (MUTT_SHOWCOLOR | MUTT_PAGER_MARKER)
 
 #define MUTT_DISPLAYFLAGS (MUTT_SHOW | MUTT_PAGER_MARKER | MUTT_PAGER_LOGS)
@@ -199,6 +200,7 @@ struct MuttWindow *ppanel_new(bool status_on_top, struct IndexSharedData *shared
 struct MuttWindow *pager_window_new(struct IndexSharedData *shared, struct PagerPrivateData *priv);
 int mutt_display_message(struct MuttWindow *win_index, struct IndexSharedData *shared);
 int external_pager(struct MailboxView *mv, struct Email *e, const char *command);
+void pager_render_cache_cleanup(void);
 void pager_queue_redraw(struct PagerPrivateData *priv, PagerRedrawFlags redraw);
 bool mutt_is_quote_line(char *buf, regmatch_t *pmatch);
 const char *pager_get_pager(struct ConfigSubset *sub);
@@ -31,6 +31,7 @@
 #include <errno.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <sys/types.h>
 #include <unistd.h>
 #include "mutt/lib.h"
@@ -60,6 +61,238 @@
 /// Status bar message when entire message is visible in the Pager
 static const char *ExtPagerProgress = N_("all");
 
+/// Maximum number of decoded Emails to keep
+#define RENDER_CACHE_SIZE 4
+
+/**
+ * struct RenderedEmail - An Email that's been decoded for the Pager
+ *
+ * Only plain Emails are cached; encrypted ones are decoded every time.
+ * The files are only readable by the user and are deleted when the Email is
+ * freed, e.g. when the Mailbox is closed.
+ */
+struct RenderedEmail
+{
+  struct Email *email; ///< Email that was decoded
+  int wrap_len;        ///< Width the Email was wrapped to
+  char *tags;          ///< Tags of the Email when it was decoded
+  char *label;         ///< X-Label of the Email when it was decoded
+  LOFF_T length;       ///< Length of the body, changed by deleting attachments
+  bool attach_del;     ///< Attachments were marked for deletion
+  char *file;          ///< Temporary file containing the decoded Email
+};
+ARRAY_HEAD(RenderedEmailArray, struct RenderedEmail);
+
+/// Recently decoded Emails, oldest first
+static struct RenderedEmailArray RenderCache = ARRAY_HEAD_INITIALIZER;
+
+static int render_cache_email_observer(struct NotifyCallback *nc);
+static int render_cache_neomutt_observer(struct NotifyCallback *nc);
+
+/**
+ * render_cache_remove - Remove a decoded Email from the cache
+ * @param index Index into the cache
+ */
+static void render_cache_remove(int index)
+{
+  struct RenderedEmail *re = ARRAY_GET(&RenderCache, index);
+  if (!re)
+    return;
+
+  notify_observer_remove(re->email->notify, render_cache_email_observer, re->email);
+  mutt_file_unlink(re->file);
+  FREE(&re->tags);
+  FREE(&re->label);
+  FREE(&re->file);
+  ARRAY_REMOVE(&RenderCache, re);
+
+  if (ARRAY_EMPTY(&RenderCache) && NeoMutt)
+    notify_observer_remove(NeoMutt->notify, render_cache_neomutt_observer, NULL);
+}
+
+/**
+ * render_cache_flush - Empty the cache of decoded Emails
+ */
+static void render_cache_flush(void)
+{
+  while (!ARRAY_EMPTY(&RenderCache))
+    render_cache_remove(0);
+}
+
+/**
+ * render_cache_email_observer - Notification that an Email has changed - Implements ::observer_t - @ingroup observer_api
+ */
+static int render_cache_email_observer(struct NotifyCallback *nc)
+{
+  if (nc->event_type != NT_EMAIL)
+    return 0;
+  if (!nc->global_data)
+    return -1;
+
+  struct Email *e = nc->global_data;
+
+  // Any change to the Email may change the way it's displayed
+  for (int i = ARRAY_SIZE(&RenderCache) - 1; i >= 0; i--)
+  {
+    struct RenderedEmail *re = ARRAY_GET(&RenderCache, i);
+    if (re->email == e)
+      render_cache_remove(i);
+  }
+
+  mutt_debug(LL_DEBUG5, "email done\n");
+  return 0;
+}
+
+/**
+ * render_cache_neomutt_observer - Notification that Config has changed - Implements ::observer_t - @ingroup observer_api
+ *
+ * A decoded Email depends on config, e.g. $weed, and commands, e.g. `ignore`.
+ * Changing either of these invalidates the cache.
+ */
+static int render_cache_neomutt_observer(struct NotifyCallback *nc)
+{
+  if ((nc->event_type != NT_CONFIG) && (nc->event_type != NT_COMMAND))
+    return 0;
+
+  render_cache_flush();
+  mutt_debug(LL_DEBUG5, "config done\n");
+  return 0;
+}
+
+/**
+ * render_cache_matches - Does a cached Email match what would be displayed?
+ * @param re       Cached Email
+ * @param e        Email
+ * @param wrap_len Width to wrap lines
+ * @param tags     Current tags of the Email
+ * @retval true The cached file can be used
+ *
+ * Changing the tags or label, or deleting attachments, doesn't notify the
+ * Email's observers, so compare them here.
+ */
+static bool render_cache_matches(const struct RenderedEmail *re, struct Email *e,
+                                 int wrap_len, const char *tags)
+{
+  return (re->wrap_len == wrap_len) && mutt_str_equal(re->tags, tags) &&
+         mutt_str_equal(re->label, e->env->x_label) &&
+         (re->length == e->body->length) && (re->attach_del == e->attach_del);
+}
+
+/**
+ * render_cache_get - Get a copy of a decoded Email from the cache
+ * @param[in]  e        Email
+ * @param[in]  wrap_len Width to wrap lines
+ * @param[out] tempfile Temporary file for the result
+ * @retval true The Email was found in the cache
+ *
+ * The Pager deletes its file once it's opened it, so the caller is given a new
+ * link to the cached file.
+ */
+static bool render_cache_get(struct Email *e, int wrap_len, struct Buffer *tempfile)
+{
+  struct Buffer *tags = buf_pool_get();
+  driver_tags_get(&e->tags, tags);
+
+  bool found = false;
+  struct RenderedEmail *re = NULL;
+  ARRAY_FOREACH(re, &RenderCache)
+  {
+    if (re->email != e)
+      continue;
+
+    if (!render_cache_matches(re, e, wrap_len, buf_string(tags)))
+    {
+      // The Email will be decoded again, and replace this entry
+      render_cache_remove(ARRAY_FOREACH_IDX_re);
+      break;
+    }
+
+    buf_mktemp(tempfile);
+    if (link(re->file, buf_string(tempfile)) != 0)
+    {
+      mutt_debug(LL_DEBUG1, "link() failed: %s (errno %d)\n", strerror(errno), errno);
+      render_cache_remove(ARRAY_FOREACH_IDX_re);
+      buf_reset(tempfile);
+      break;
+    }
+
+    // Move the Email to the end of the list, the most recently used
+    struct RenderedEmail re_copy = *re;
+    ARRAY_REMOVE(&RenderCache, re);
+    ARRAY_ADD(&RenderCache, re_copy);
+
+    mutt_debug(LL_DEBUG2, "using decoded email %s\n", re_copy.file);
+    found = true;
+    break;
+  }
+
+  buf_pool_release(&tags);
+  return found;
+}
+
+/**
+ * render_cache_add - Add a decoded Email to the cache
+ * @param e        Email
+ * @param wrap_len Width the lines were wrapped to
+ * @param tempfile Temporary file containing the decoded Email
+ *
+ * An Email is only cached once.  The observer is shared by all the entries for
+ * an Email, so keeping several would leave some of them unobserved.
+ */
+static void render_cache_add(struct Email *e, int wrap_len, struct Buffer *tempfile)
+{
+  struct Buffer *file = buf_pool_get();
+  buf_mktemp(file);
+  if (link(buf_string(tempfile), buf_string(file)) != 0)
+  {
+    mutt_debug(LL_DEBUG1, "link() failed: %s (errno %d)\n", strerror(errno), errno);
+    goto done;
+  }
+
+  struct RenderedEmail *re_old = NULL;
+  ARRAY_FOREACH(re_old, &RenderCache)
+  {
+    if (re_old->email == e)
+    {
+      render_cache_remove(ARRAY_FOREACH_IDX_re_old);
+      break;
+    }
+  }
+
+  if (ARRAY_SIZE(&RenderCache) >= RENDER_CACHE_SIZE)
+    render_cache_remove(0);
+
+  if (ARRAY_EMPTY(&RenderCache))
+    notify_observer_add(NeoMutt->notify, NT_ALL, render_cache_neomutt_observer, NULL);
+
+  struct Buffer *tags = buf_pool_get();
+  driver_tags_get(&e->tags, tags);
+
+  struct RenderedEmail re = { 0 };
+  re.email = e;
+  re.wrap_len = wrap_len;
+  re.tags = buf_strdup(tags);
+  re.label = mutt_str_dup(e->env->x_label);
+  re.length = e->body->length;
+  re.attach_del = e->attach_del;
+  re.file = buf_strdup(file);
+  ARRAY_ADD(&RenderCache, re);
+  buf_pool_release(&tags);
+  notify_observer_add(e->notify, NT_EMAIL, render_cache_email_observer, e);
+
+done:
+  buf_pool_release(&file);
+}
+
+/**
+ * pager_render_cache_cleanup - Delete the cache of decoded Emails
+ */
+void pager_render_cache_cleanup(void)
+{
+  render_cache_flush();
+  ARRAY_FREE(&RenderCache);
+}
+
 /**
  * process_protected_headers - Get the protected header and update the index
  * @param m Mailbox
@@ -168,9 +401,6 @@ static int email_to_file(struct Message *msg, struct Buffer *tempfile,
   int rc = 0;
   pid_t filterpid = -1;
 
-  mutt_parse_mime_message(e, msg->fp);
-  mutt_message_hook(m, e, MUTT_MESSAGE_HOOK);
-
   char columns[16] = { 0 };
   // win_pager might not be visible and have a size yet, so use win_index
   snprintf(columns, sizeof(columns), "%d", wrap_len);
@@ -315,6 +545,9 @@ int external_pager(struct MailboxView *mv, struct Email *e, const char *command)
 
   struct Buffer *tempfile = buf_pool_get();
 
+  mutt_parse_mime_message(e, msg->fp);
+  mutt_message_hook(m, e, MUTT_MESSAGE_HOOK);
+
   CopyMessageFlags cmflags = MUTT_CM_DECODE | MUTT_CM_DISPLAY | MUTT_CM_CHARCONV;
   int rc = email_to_file(msg, tempfile, m, e, buf_string(buf), screen_width, &cmflags);
   if (rc < 0)
@@ -463,12 +696,30 @@ int mutt_display_message(struct MuttWindow *win_index, struct IndexSharedData *s
 
     CopyMessageFlags cmflags = MUTT_CM_DECODE | MUTT_CM_DISPLAY | MUTT_CM_CHARCONV;
 
+    struct Email *e = shared->email;
+    mutt_parse_mime_message(e, msg->fp);
+    // The hook may change the config, which will empty the cache
+    mutt_message_hook(shared->mailbox, e, MUTT_MESSAGE_HOOK);
+
     buf_reset(tempfile);
     // win_pager might not be visible and have a size yet, so use win_index
-    rc = email_to_file(msg, tempfile, shared->mailbox, shared->email, NULL,
-                       win_index->state.cols, &cmflags);
-    if (rc < 0)
-      break;
+    const int wrap_len = win_index->state.cols;
+    bool clear = false;
+    // Encrypted and signed Emails need verifying every time
+    if ((e->security != SEC_NO_FLAGS) || !render_cache_get(e, wrap_len, tempfile))
+    {
+      rc = email_to_file(msg, tempfile, shared->mailbox, e, NULL, wrap_len, &cmflags);
+      if (rc < 0)
+        break;
+
+      if (e->security == SEC_NO_FLAGS)
+        render_cache_add(e, wrap_len, tempfile);
+
+      // The display filter, or the crypto backend, e.g. pinentry, may have
+      // written to the terminal
+      const char *const c_display_filter = cs_subset_string(NeoMutt->sub, "display_filter");
+      clear = (e->security != SEC_NO_FLAGS) || c_display_filter;
+    }
 
     notify_crypto(shared->email, msg, cmflags);
 
@@ -482,7 +733,8 @@ int mutt_display_message(struct MuttWindow *win_index, struct IndexSharedData *s
     pview.mode = PAGER_MODE_EMAIL;
     pview.banner = NULL;
     pview.flags = MUTT_PAGER_MESSAGE |
-                  (shared->email->body->nowrap ? MUTT_PAGER_NOWRAP : 0);
+                  (shared->email->body->nowrap ? MUTT_PAGER_NOWRAP : 0) |
+                  (clear ? MUTT_PAGER_CLEAR : 0);
     pview.win_index = win_index;
     pview.win_pbar = win_pbar;
     pview.win_pager = win_pager;
@@ -44,6 +44,7 @@ struct PopAccountData
   unsigned int cmd_user : 2; ///< optional command USER
   unsigned int cmd_uidl : 2; ///< optional command UIDL
   unsigned int cmd_top  : 2; ///< optional command TOP
+  bool cmd_pipelining   : 1; ///< server supports PIPELINING (RFC2449)
   bool resp_codes       : 1; ///< server supports extended response codes
   bool expire           : 1; ///< expire is greater than 0
   bool clear_cache      : 1;
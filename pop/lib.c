@@ -168,6 +168,10 @@ static int fetch_capa(const char *line, void *data)
   {
     adata->cmd_top = 1;
   }
+  else if (mutt_istr_startswith(line, "PIPELINING"))
+  {
+    adata->cmd_pipelining = true;
+  }
 
   return 0;
 }
@@ -215,6 +219,7 @@ static int pop_capabilities(struct PopAccountData *adata, int mode)
     adata->cmd_user = 0;
     adata->cmd_uidl = 0;
     adata->cmd_top = 0;
+    adata->cmd_pipelining = false;
     adata->resp_codes = false;
     adata->expire = true;
     adata->login_delay = 0;
@@ -475,10 +480,52 @@ int pop_query_d(struct PopAccountData *adata, char *buf, size_t buflen, char *ms
 
   mutt_socket_send_d(adata->conn, buf, MUTT_SOCK_LOG_FULL);
 
-  char *c = strpbrk(buf, " \r\n");
-  if (c)
-    *c = '\0';
-  snprintf(adata->err_msg, sizeof(adata->err_msg), "%s: ", buf);
+  return pop_query_recv(adata, buf, buf, buflen);
+}
+
+/**
+ * pop_query_send - Send a command without waiting for the answer
+ * @param adata POP Account data
+ * @param cmd   Command(s) to send, each terminated by CRLF
+ * @retval  0 Successful
+ * @retval -1 Connection lost
+ *
+ * Used for pipelining (RFC2449).  The answers must be read, in order, with
+ * pop_query_recv() or pop_fetch_data_recv().
+ */
+int pop_query_send(struct PopAccountData *adata, const char *cmd)
+{
+  if (adata->status != POP_CONNECTED)
+    return -1;
+
+  if (mutt_socket_send_d(adata->conn, cmd, MUTT_SOCK_LOG_FULL) < 0)
+  {
+    adata->status = POP_DISCONNECTED;
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * pop_query_recv - Receive the answer to a command
+ * @param adata  POP Account data
+ * @param cmd    Command that was sent, used for error messages
+ * @param buf    Buffer for the answer
+ * @param buflen Buffer length
+ * @retval  0 Successful
+ * @retval -1 Connection lost
+ * @retval -2 Invalid command or execution error
+ *
+ * @note cmd and buf may be the same buffer
+ */
+int pop_query_recv(struct PopAccountData *adata, const char *cmd, char *buf, size_t buflen)
+{
+  if (adata->status != POP_CONNECTED)
+    return -1;
+
+  const int len = strcspn(cmd, " \r\n");
+  snprintf(adata->err_msg, sizeof(adata->err_msg), "%.*s: ", len, cmd);
 
   if (mutt_socket_readln_d(buf, buflen, adata->conn, MUTT_SOCK_LOG_FULL) < 0)
   {
@@ -509,13 +556,36 @@ int pop_query_d(struct PopAccountData *adata, char *buf, size_t buflen, char *ms
  */
 int pop_fetch_data(struct PopAccountData *adata, const char *query,
                    struct Progress *progress, pop_fetch_t callback, void *data)
+{
+  int rc = pop_query_send(adata, query);
+  if (rc < 0)
+    return rc;
+
+  return pop_fetch_data_recv(adata, query, progress, callback, data);
+}
+
+/**
+ * pop_fetch_data_recv - Receive the multi-line answer to a command
+ * @param adata    POP Account data
+ * @param query    POP query that was sent to the server
+ * @param progress Progress bar
+ * @param callback Function called for each header read
+ * @param data     Data to pass to the callback
+ * @retval  0 Successful
+ * @retval -1 Connection lost
+ * @retval -2 Invalid command or execution error
+ * @retval -3 Error in callback(*line, *data)
+ *
+ * The reading half of pop_fetch_data(), for commands sent by pop_query_send().
+ */
+int pop_fetch_data_recv(struct PopAccountData *adata, const char *query,
+                        struct Progress *progress, pop_fetch_t callback, void *data)
 {
   char buf[1024] = { 0 };
   long pos = 0;
   size_t lenbuf = 0;
 
-  mutt_str_copy(buf, query, sizeof(buf));
-  int rc = pop_query(adata, buf, sizeof(buf));
+  int rc = pop_query_recv(adata, query, buf, sizeof(buf));
   if (rc < 0)
     return rc;
 
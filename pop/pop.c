@@ -106,16 +106,46 @@ static int fetch_message(const char *line, void *data)
   return 0;
 }
 
+/**
+ * fetch_discard - Ignore a Message response - Implements ::pop_fetch_t - @ingroup pop_fetch_api
+ * @param line String to ignore
+ * @param data Unused
+ * @retval 0 (always)
+ */
+static int fetch_discard(const char *line, void *data)
+{
+  return 0;
+}
+
+/**
+ * pop_read_header_send - Request a header, without waiting for the answer
+ * @param adata POP Account data
+ * @param e     Email
+ * @retval  0 Success
+ * @retval -1 Connection lost
+ *
+ * The answers are read by pop_read_header().
+ */
+static int pop_read_header_send(struct PopAccountData *adata, struct Email *e)
+{
+  char buf[128] = { 0 };
+  struct PopEmailData *edata = pop_edata_get(e);
+
+  snprintf(buf, sizeof(buf), "LIST %d\r\nTOP %d 0\r\n", edata->refno, edata->refno);
+  return pop_query_send(adata, buf);
+}
+
 /**
  * pop_read_header - Read header
  * @param adata POP Account data
  * @param e     Email
+ * @param sent  The commands have already been sent by pop_read_header_send()
  * @retval  0 Success
  * @retval -1 Connection lost
  * @retval -2 Invalid command or execution error
  * @retval -3 Error writing to tempfile
  */
-static int pop_read_header(struct PopAccountData *adata, struct Email *e)
+static int pop_read_header(struct PopAccountData *adata, struct Email *e, bool sent)
 {
   FILE *fp = mutt_file_mkstemp();
   if (!fp)
@@ -131,13 +161,17 @@ static int pop_read_header(struct PopAccountData *adata, struct Email *e)
   struct PopEmailData *edata = pop_edata_get(e);
 
   snprintf(buf, sizeof(buf), "LIST %d\r\n", edata->refno);
-  int rc = pop_query(adata, buf, sizeof(buf));
+  int rc = sent ? pop_query_recv(adata, buf, buf, sizeof(buf)) :
+                  pop_query(adata, buf, sizeof(buf));
   if (rc == 0)
   {
     sscanf(buf, "+OK %d %zu", &index, &length);
 
     snprintf(buf, sizeof(buf), "TOP %d 0\r\n", edata->refno);
-    rc = pop_fetch_data(adata, buf, NULL, fetch_message, fp);
+    if (sent)
+      rc = pop_fetch_data_recv(adata, buf, NULL, fetch_message, fp);
+    else
+      rc = pop_fetch_data(adata, buf, NULL, fetch_message, fp);
 
     if (adata->cmd_top == 2)
     {
@@ -371,6 +405,11 @@ static int pop_fetch_headers(struct Mailbox *m)
     progress_set_message(progress, _("Fetching message headers..."));
   }
 
+  /* With PIPELINING, request the headers ahead of reading them */
+  const bool pipelining = adata->cmd_pipelining && (adata->cmd_top == 1);
+  bool *hcached = MUTT_MEM_CALLOC(MAX(new_count - old_count, 1), bool);
+  int sent = old_count;
+
   if (rc == 0)
   {
     int i, deleted;
@@ -390,12 +429,10 @@ static int pop_fetch_headers(struct Mailbox *m)
                  deleted);
     }
 
-    bool hcached = false;
+#ifdef USE_HCACHE
     for (i = old_count; i < new_count; i++)
     {
-      progress_update(progress, i + 1 - old_count, -1);
       struct PopEmailData *edata = pop_edata_get(m->emails[i]);
-#ifdef USE_HCACHE
       struct HCacheEntry hce = hcache_fetch_email(hc, edata->uid, strlen(edata->uid), 0);
       if (hce.email)
       {
@@ -417,19 +454,35 @@ static int pop_fetch_headers(struct Mailbox *m)
         /* Reattach the private data */
         m->emails[i]->edata = edata;
         m->emails[i]->edata_free = pop_edata_free;
-        rc = 0;
-        hcached = true;
+        hcached[i - old_count] = true;
       }
-      else
+    }
 #endif
-          if ((rc = pop_read_header(adata, m->emails[i])) < 0)
-        break;
-#ifdef USE_HCACHE
-      else
+
+    for (i = old_count; i < new_count; i++)
+    {
+      progress_update(progress, i + 1 - old_count, -1);
+      struct PopEmailData *edata = pop_edata_get(m->emails[i]);
+      if (!hcached[i - old_count])
       {
+        /* Keep a window of requests in flight */
+        for (; pipelining && (sent < new_count) && (sent < (i + POP_PIPELINE_DEPTH)); sent++)
+        {
+          if (hcached[sent - old_count])
+            continue;
+          rc = pop_read_header_send(adata, m->emails[sent]);
+          if (rc < 0)
+            break;
+        }
+
+        if (rc == 0)
+          rc = pop_read_header(adata, m->emails[i], pipelining);
+        if (rc < 0)
+          break;
+#ifdef USE_HCACHE
         hcache_store_email(hc, edata->uid, strlen(edata->uid), m->emails[i], 0);
-      }
 #endif
+      }
 
       /* faked support for flags works like this:
        * - if 'hcached' is true, we have the message in our hcache:
@@ -444,7 +497,7 @@ static int pop_fetch_headers(struct Mailbox *m)
       const bool bcached = (mutt_bcache_exists(adata->bcache, cache_id(edata->uid)) == 0);
       m->emails[i]->old = false;
       m->emails[i]->read = false;
-      if (hcached)
+      if (hcached[i - old_count])
       {
         const bool c_mark_old = cs_subset_bool(NeoMutt->sub, "mark_old");
         if (bcached)
@@ -462,6 +515,7 @@ static int pop_fetch_headers(struct Mailbox *m)
     }
   }
   progress_free(&progress);
+  FREE(&hcached);
 
 #ifdef USE_HCACHE
   hcache_close(&hc);
@@ -469,6 +523,13 @@ static int pop_fetch_headers(struct Mailbox *m)
 
   if (rc < 0)
   {
+    /* Unread answers may still be in flight; start afresh next time */
+    if (pipelining && (sent > m->msg_count) && (adata->status == POP_CONNECTED))
+    {
+      mutt_socket_close(adata->conn);
+      adata->status = POP_DISCONNECTED;
+    }
+
     for (int i = m->msg_count; i < new_count; i++)
       email_free(&m->emails[i]);
     return rc;
@@ -606,13 +667,29 @@ void pop_fetch_mail(void)
            bytes);
   mutt_message("%s", msgbuf);
 
+  /* With PIPELINING, request the messages ahead of reading them and delete
+   * them all at the end.  The server only deletes them on QUIT anyway. */
+  const bool pipelining = adata->cmd_pipelining;
+  int sent = last + 1;
+  int done = last;
+
   for (int i = last + 1; i <= msgs; i++)
   {
+    for (; pipelining && (sent <= msgs) && (sent < (i + POP_PIPELINE_DEPTH)); sent++)
+    {
+      snprintf(buf, sizeof(buf), "RETR %d\r\n", sent);
+      if (pop_query_send(adata, buf) < 0)
+        break;
+    }
+
     struct Message *msg = mx_msg_open_new(m_spool, NULL, MUTT_ADD_FROM);
     if (msg)
     {
       snprintf(buf, sizeof(buf), "RETR %d\r\n", i);
-      rc = pop_fetch_data(adata, buf, NULL, fetch_message, msg->fp);
+      if (pipelining)
+        rc = pop_fetch_data_recv(adata, buf, NULL, fetch_message, msg->fp);
+      else
+        rc = pop_fetch_data(adata, buf, NULL, fetch_message, msg->fp);
       if (rc == -3)
         rset = 1;
 
@@ -626,10 +703,18 @@ void pop_fetch_mail(void)
     }
     else
     {
+      if (pipelining)
+      {
+        snprintf(buf, sizeof(buf), "RETR %d\r\n", i);
+        pop_fetch_data_recv(adata, buf, NULL, fetch_discard, NULL);
+      }
       rc = -3;
     }
 
-    if ((rc == 0) && (delanswer == MUTT_YES))
+    if (rc == 0)
+      done = i;
+
+    if ((rc == 0) && !pipelining && (delanswer == MUTT_YES))
     {
       /* delete the message on the server */
       snprintf(buf, sizeof(buf), "DELE %d\r\n", i);
@@ -663,6 +748,37 @@ void pop_fetch_mail(void)
   m_spool->append = old_append;
   mx_mbox_close(m_spool);
 
+  if (pipelining)
+  {
+    /* Skip the answers to any messages requested, but not read */
+    for (int i = done + 2; i < sent; i++)
+    {
+      snprintf(buf, sizeof(buf), "RETR %d\r\n", i);
+      if (pop_fetch_data_recv(adata, buf, NULL, fetch_discard, NULL) == -1)
+        goto fail;
+    }
+
+    if (delanswer == MUTT_YES)
+    {
+      for (int i = last + 1, j = last + 1; i <= done; i++)
+      {
+        for (; (j <= done) && (j < (i + POP_PIPELINE_DEPTH)); j++)
+        {
+          snprintf(buf, sizeof(buf), "DELE %d\r\n", j);
+          if (pop_query_send(adata, buf) < 0)
+            goto fail;
+        }
+
+        snprintf(buf, sizeof(buf), "DELE %d\r\n", i);
+        rc = pop_query_recv(adata, buf, buf, sizeof(buf));
+        if (rc == -1)
+          goto fail;
+        if (rc == -2)
+          mutt_error("%s", adata->err_msg);
+      }
+    }
+  }
+
   if (rset)
   {
     /* make sure no messages get deleted */
@@ -890,6 +1006,8 @@ static enum MxStatus pop_mbox_sync(struct Mailbox *m)
       progress_set_message(progress, _("Marking messages deleted..."));
     }
 
+    const bool pipelining = adata->cmd_pipelining;
+    int sent = 0;
     for (i = 0, j = 0, rc = 0; (rc == 0) && (i < m->msg_count); i++)
     {
       struct PopEmailData *edata = pop_edata_get(m->emails[i]);
@@ -897,8 +1015,23 @@ static enum MxStatus pop_mbox_sync(struct Mailbox *m)
       {
         j++;
         progress_update(progress, j, -1);
+
+        /* Keep a window of requests in flight */
+        for (; pipelining && (sent < m->msg_count) && (sent < (i + POP_PIPELINE_DEPTH)); sent++)
+        {
+          struct PopEmailData *edata2 = pop_edata_get(m->emails[sent]);
+          if (!m->emails[sent]->deleted || (edata2->refno == -1))
+            continue;
+          snprintf(buf, sizeof(buf), "DELE %d\r\n", edata2->refno);
+          rc = pop_query_send(adata, buf);
+          if (rc < 0)
+            break;
+        }
+
         snprintf(buf, sizeof(buf), "DELE %d\r\n", edata->refno);
-        rc = pop_query(adata, buf, sizeof(buf));
+        if (rc == 0)
+          rc = pipelining ? pop_query_recv(adata, buf, buf, sizeof(buf)) :
+                            pop_query(adata, buf, sizeof(buf));
         if (rc == 0)
         {
           mutt_bcache_del(adata->bcache, cache_id(edata->uid));
@@ -921,6 +1054,14 @@ static enum MxStatus pop_mbox_sync(struct Mailbox *m)
     hcache_close(&hc);
 #endif
 
+    /* Unread answers may still be in flight; don't QUIT, which would commit
+     * the deletions, just drop the connection */
+    if (pipelining && (rc == -2))
+    {
+      mutt_socket_close(adata->conn);
+      adata->status = POP_DISCONNECTED;
+    }
+
     if (rc == 0)
     {
       mutt_str_copy(buf, "QUIT\r\n", sizeof(buf));
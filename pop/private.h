@@ -41,6 +41,9 @@ struct Progress;
 /* maximal length of the server response (RFC1939) */
 #define POP_CMD_RESPONSE 512
 
+/* number of messages to request ahead when the server supports PIPELINING */
+#define POP_PIPELINE_DEPTH 16
+
 /**
  * enum PopStatus - POP server responses
  */
@@ -113,8 +116,12 @@ int pop_parse_path(const char *path, struct ConnAccount *acct);
 int pop_connect(struct PopAccountData *adata);
 int pop_open_connection(struct PopAccountData *adata);
 int pop_query_d(struct PopAccountData *adata, char *buf, size_t buflen, char *msg);
+int pop_query_send(struct PopAccountData *adata, const char *cmd);
+int pop_query_recv(struct PopAccountData *adata, const char *cmd, char *buf, size_t buflen);
 int pop_fetch_data(struct PopAccountData *adata, const char *query,
                    struct Progress *progress, pop_fetch_t callback, void *data);
+int pop_fetch_data_recv(struct PopAccountData *adata, const char *query,
+                        struct Progress *progress, pop_fetch_t callback, void *data);
 int pop_reconnect(struct Mailbox *m);
 void pop_logout(struct Mailbox *m);
 const char *pop_get_field(enum ConnAccountField field, void *gf_data);
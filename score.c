@@ -53,6 +53,7 @@ struct Score
   char *str;
   struct PatternList *pat;
   int val;
+  int gen;            ///< Generation when the rule was added
   bool exact;         ///< If this rule matches, don't evaluate any more
   struct Score *next; ///< Linked list
 };
@@ -60,6 +61,12 @@ struct Score
 /// Linked list of email scoring rules
 static struct Score *ScoreList = NULL;
 
+/// Generation of the scoring rules, incremented whenever they change
+static int ScoreGen = 0;
+
+/// Generation of the last change that wasn't a new rule, e.g. 'unscore'
+static int ScoreResetGen = 0;
+
 /**
  * mutt_check_rescore - Do the emails need to have their scores recalculated?
  * @param m Mailbox
@@ -121,6 +128,7 @@ enum CommandResult parse_score(struct Buffer *buf, struct Buffer *s,
      * as here 'ptr' != NULL -> update the value only in which case
      * ptr->str already has the string, so pattern should be freed.  */
     FREE(&pattern);
+    ScoreResetGen = ++ScoreGen;
   }
   else
   {
@@ -133,6 +141,7 @@ enum CommandResult parse_score(struct Buffer *buf, struct Buffer *s,
       return MUTT_CMD_ERROR;
     }
     ptr = MUTT_MEM_CALLOC(1, struct Score);
+    ptr->gen = ++ScoreGen;
     if (last)
       last->next = ptr;
     else
@@ -161,25 +170,48 @@ enum CommandResult parse_score(struct Buffer *buf, struct Buffer *s,
  * @param m        Mailbox
  * @param e        Email
  * @param upd_mbox If true, update the Mailbox too
+ *
+ * New rules are added to the end of the list, so if the only change since the
+ * Email was last scored is new rules, just apply those to its previous total.
+ * Any other change to the rules means starting again.
+ *
+ * Changing an Email's flags, label or tags resets Email.score_gen, so any rules
+ * that depend on them are evaluated again.  Changes made by the server are
+ * picked up by mview_update(), which always does a full rescore.
+ *
+ * @note To force a full rescore, set Email.score_gen to 0 first
  */
 void mutt_score_message(struct Mailbox *m, struct Email *e, bool upd_mbox)
 {
-  struct Score *tmp = NULL;
+  struct Score *tmp = ScoreList;
   struct PatternCache cache = { 0 };
 
-  e->score = 0; /* in case of re-scoring */
-  for (tmp = ScoreList; tmp; tmp = tmp->next)
+  if ((e->score_gen == 0) || (e->score_gen < ScoreResetGen))
+  {
+    e->score_sum = 0; /* in case of re-scoring */
+    e->score_final = false;
+  }
+  else
+  {
+    for (; tmp && (tmp->gen <= e->score_gen); tmp = tmp->next)
+      ; // do nothing
+  }
+
+  e->score = e->score_sum;
+  for (; tmp && !e->score_final; tmp = tmp->next)
   {
     if (mutt_pattern_exec(SLIST_FIRST(tmp->pat), MUTT_MATCH_FULL_ADDRESS, NULL, e, &cache) > 0)
     {
       if (tmp->exact || (tmp->val == 9999) || (tmp->val == -9999))
       {
         e->score = tmp->val;
+        e->score_final = true;
         break;
       }
       e->score += tmp->val;
     }
   }
+  e->score_sum = e->score;
   if (e->score < 0)
     e->score = 0;
 
@@ -193,6 +225,9 @@ void mutt_score_message(struct Mailbox *m, struct Email *e, bool upd_mbox)
     mutt_set_flag(m, e, MUTT_READ, true, upd_mbox);
   if (e->score >= c_score_threshold_flag)
     mutt_set_flag(m, e, MUTT_FLAG, true, upd_mbox);
+
+  // Set after the flags, which would otherwise force a full rescore next time
+  e->score_gen = ScoreGen;
 }
 
 /**
@@ -216,6 +251,7 @@ enum CommandResult parse_unscore(struct Buffer *buf, struct Buffer *s,
         FREE(&last);
       }
       ScoreList = NULL;
+      ScoreResetGen = ++ScoreGen;
     }
     else
     {
@@ -229,6 +265,7 @@ enum CommandResult parse_unscore(struct Buffer *buf, struct Buffer *s,
             ScoreList = tmp->next;
           mutt_pattern_free(&tmp->pat);
           FREE(&tmp);
+          ScoreResetGen = ++ScoreGen;
           /* there should only be one score per pattern, so we can stop here */
           break;
         }
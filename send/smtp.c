@@ -75,6 +75,11 @@
 #define SMTP_AUTH_UNAVAIL 1
 #define SMTP_AUTH_FAIL -1
 
+/* Send the message body in chunks of this size */
+#define SMTP_CHUNK_SIZE 65536
+/* Maximum number of BDAT responses to leave unread */
+#define SMTP_PIPELINE_DEPTH 8
+
 // clang-format off
 /**
  * typedef SmtpCapFlags - SMTP server capabilities
@@ -86,7 +91,9 @@ typedef uint8_t SmtpCapFlags;          ///< Flags, e.g. #SMTP_CAP_STARTTLS
 #define SMTP_CAP_DSN          (1 << 2) ///< Server supports Delivery Status Notification
 #define SMTP_CAP_EIGHTBITMIME (1 << 3) ///< Server supports 8-bit MIME content
 #define SMTP_CAP_SMTPUTF8     (1 << 4) ///< Server accepts UTF-8 strings
-#define SMTP_CAP_ALL         ((1 << 5) - 1)
+#define SMTP_CAP_PIPELINING   (1 << 5) ///< Server supports command pipelining (RFC2920)
+#define SMTP_CAP_CHUNKING     (1 << 6) ///< Server supports BDAT command (RFC3030)
+#define SMTP_CAP_ALL         ((1 << 7) - 1)
 // clang-format on
 
 /**
@@ -99,6 +106,8 @@ struct SmtpAccountData
   struct Connection *conn;   ///< Server Connection
   struct ConfigSubset *sub;  ///< Config scope
   const char *fqdn;          ///< Fully-qualified domain name
+  struct Buffer *pipeline;   ///< Commands waiting to be sent, if the server supports PIPELINING
+  int pending;               ///< Number of responses waiting to be read
 };
 
 /**
@@ -175,6 +184,14 @@ static int smtp_get_resp(struct SmtpAccountData *adata)
     {
       adata->capabilities |= SMTP_CAP_SMTPUTF8;
     }
+    else if (mutt_istr_startswith(s, "PIPELINING"))
+    {
+      adata->capabilities |= SMTP_CAP_PIPELINING;
+    }
+    else if (mutt_istr_startswith(s, "CHUNKING"))
+    {
+      adata->capabilities |= SMTP_CAP_CHUNKING;
+    }
 
     if (!valid_smtp_code(buf, &n))
       return SMTP_ERR_CODE;
@@ -188,6 +205,60 @@ static int smtp_get_resp(struct SmtpAccountData *adata)
   return -1;
 }
 
+/**
+ * smtp_send_cmd - Send a command to the SMTP server
+ * @param adata SMTP Account data
+ * @param cmd   Command, terminated by CRLF
+ * @retval  0 Success
+ * @retval <0 Error, e.g. #SMTP_ERR_WRITE
+ *
+ * If the server supports PIPELINING, the command is only queued.
+ * smtp_flush() sends the queue and reads the responses.
+ */
+static int smtp_send_cmd(struct SmtpAccountData *adata, const char *cmd)
+{
+  if (adata->pipeline)
+  {
+    buf_addstr(adata->pipeline, cmd);
+    adata->pending++;
+    return 0;
+  }
+
+  if (mutt_socket_send(adata->conn, cmd) == -1)
+    return SMTP_ERR_WRITE;
+
+  return smtp_get_resp(adata);
+}
+
+/**
+ * smtp_flush - Send any queued commands and read their responses
+ * @param adata SMTP Account data
+ * @param keep  Number of responses that may be left unread
+ * @retval  0 Success
+ * @retval <0 Error, e.g. #SMTP_ERR_WRITE
+ *
+ * The responses are read in order.  The first failure ends the session.
+ */
+static int smtp_flush(struct SmtpAccountData *adata, int keep)
+{
+  if (adata->pipeline && !buf_is_empty(adata->pipeline))
+  {
+    int rc = mutt_socket_send(adata->conn, buf_string(adata->pipeline));
+    buf_reset(adata->pipeline);
+    if (rc == -1)
+      return SMTP_ERR_WRITE;
+  }
+
+  for (; adata->pending > keep; adata->pending--)
+  {
+    int rc = smtp_get_resp(adata);
+    if (rc != 0)
+      return rc;
+  }
+
+  return 0;
+}
+
 /**
  * smtp_rcpt_to - Set the recipient to an Address
  * @param adata SMTP Account data
@@ -220,9 +291,7 @@ static int smtp_rcpt_to(struct SmtpAccountData *adata, const struct AddressList
     {
       snprintf(buf, sizeof(buf), "RCPT TO:<%s>\r\n", buf_string(a->mailbox));
     }
-    if (mutt_socket_send(adata->conn, buf) == -1)
-      return SMTP_ERR_WRITE;
-    int rc = smtp_get_resp(adata);
+    int rc = smtp_send_cmd(adata, buf);
     if (rc != 0)
       return rc;
   }
@@ -230,6 +299,45 @@ static int smtp_rcpt_to(struct SmtpAccountData *adata, const struct AddressList
   return 0;
 }
 
+/**
+ * smtp_send_chunk - Send part of the message body
+ * @param adata SMTP Account data
+ * @param chunk Data to send; it will be emptied
+ * @param last  This is the last chunk of the message
+ * @retval  0 Success
+ * @retval <0 Error, e.g. #SMTP_ERR_WRITE
+ *
+ * If the server supports CHUNKING, the data is sent with a BDAT command.
+ * Otherwise, it must already be dot-stuffed, as part of a DATA command.
+ */
+static int smtp_send_chunk(struct SmtpAccountData *adata, struct Buffer *chunk, bool last)
+{
+  const bool chunking = (adata->capabilities & SMTP_CAP_CHUNKING);
+
+  if (chunking)
+  {
+    char cmd[64] = { 0 };
+    snprintf(cmd, sizeof(cmd), "BDAT %zu%s\r\n", buf_len(chunk), last ? " LAST" : "");
+    if (mutt_socket_send(adata->conn, cmd) == -1)
+      return SMTP_ERR_WRITE;
+  }
+
+  if (!buf_is_empty(chunk) &&
+      (mutt_socket_write_d(adata->conn, buf_string(chunk), buf_len(chunk),
+                           MUTT_SOCK_LOG_FULL) == -1))
+  {
+    return SMTP_ERR_WRITE;
+  }
+  buf_reset(chunk);
+
+  if (!chunking)
+    return 0;
+
+  /* With PIPELINING, don't wait for each BDAT response */
+  adata->pending++;
+  return smtp_flush(adata, (adata->pipeline && !last) ? SMTP_PIPELINE_DEPTH : 0);
+}
+
 /**
  * smtp_data - Send data to an SMTP server
  * @param adata   SMTP Account data
@@ -241,9 +349,11 @@ static int smtp_data(struct SmtpAccountData *adata, const char *msgfile)
 {
   char buf[1024] = { 0 };
   struct Progress *progress = NULL;
+  struct Buffer *chunk = NULL;
   int rc = SMTP_ERR_WRITE;
   int term = 0;
   size_t buflen = 0;
+  const bool chunking = (adata->capabilities & SMTP_CAP_CHUNKING);
 
   FILE *fp = mutt_file_fopen(msgfile, "r");
   if (!fp)
@@ -261,56 +371,53 @@ static int smtp_data(struct SmtpAccountData *adata, const char *msgfile)
   progress = progress_new(MUTT_PROGRESS_NET, size);
   progress_set_message(progress, _("Sending message..."));
 
-  snprintf(buf, sizeof(buf), "DATA\r\n");
-  if (mutt_socket_send(adata->conn, buf) == -1)
-  {
-    mutt_file_fclose(&fp);
-    goto done;
-  }
-  rc = smtp_get_resp(adata);
+  /* With CHUNKING, the body is sent with BDAT instead */
+  rc = chunking ? 0 : smtp_send_cmd(adata, "DATA\r\n");
+  if (rc == 0)
+    rc = smtp_flush(adata, 0);
   if (rc != 0)
   {
     mutt_file_fclose(&fp);
     goto done;
   }
 
-  rc = SMTP_ERR_WRITE;
+  /* Collect the lines into large chunks, rather than writing them one by one */
+  chunk = buf_pool_get();
   while (fgets(buf, sizeof(buf) - 1, fp))
   {
     buflen = mutt_str_len(buf);
     term = buflen && buf[buflen - 1] == '\n';
     if (term && ((buflen == 1) || (buf[buflen - 2] != '\r')))
       snprintf(buf + buflen - 1, sizeof(buf) - buflen + 1, "\r\n");
-    if (buf[0] == '.')
+    if (!chunking && (buf[0] == '.'))
+      buf_addch(chunk, '.');
+    buf_addstr(chunk, buf);
+
+    if (buf_len(chunk) >= SMTP_CHUNK_SIZE)
     {
-      if (mutt_socket_send_d(adata->conn, ".", MUTT_SOCK_LOG_FULL) == -1)
+      rc = smtp_send_chunk(adata, chunk, false);
+      if (rc != 0)
       {
         mutt_file_fclose(&fp);
         goto done;
       }
+      progress_update(progress, MAX(0, ftell(fp)), -1);
     }
-    if (mutt_socket_send_d(adata->conn, buf, MUTT_SOCK_LOG_FULL) == -1)
-    {
-      mutt_file_fclose(&fp);
-      goto done;
-    }
-    progress_update(progress, MAX(0, ftell(fp)), -1);
-  }
-  if (!term && buflen &&
-      (mutt_socket_send_d(adata->conn, "\r\n", MUTT_SOCK_LOG_FULL) == -1))
-  {
-    mutt_file_fclose(&fp);
-    goto done;
   }
+  if (!term && buflen)
+    buf_addstr(chunk, "\r\n");
   mutt_file_fclose(&fp);
 
   /* terminate the message body */
-  if (mutt_socket_send(adata->conn, ".\r\n") == -1)
-    goto done;
+  if (!chunking)
+    buf_addstr(chunk, ".\r\n");
 
-  rc = smtp_get_resp(adata);
+  rc = smtp_send_chunk(adata, chunk, true);
+  if ((rc == 0) && !chunking)
+    rc = smtp_get_resp(adata);
 
 done:
+  buf_pool_release(&chunk);
   progress_free(&progress);
   return rc;
 }
@@ -1147,6 +1254,10 @@ int mutt_smtp_send(const struct AddressList *from, const struct AddressList *to,
       break;
     FREE(&adata.auth_mechs);
 
+    /* Send the envelope commands in one go, see smtp_flush() */
+    if (adata.capabilities & SMTP_CAP_PIPELINING)
+      adata.pipeline = buf_pool_get();
+
     /* send the sender's address */
     buf_printf(buf, "MAIL FROM:<%s>", envfrom);
     if (eightbit && (adata.capabilities & SMTP_CAP_EIGHTBITMIME))
@@ -1162,12 +1273,7 @@ int mutt_smtp_send(const struct AddressList *from, const struct AddressList *to,
       buf_addstr(buf, " SMTPUTF8");
     }
     buf_addstr(buf, "\r\n");
-    if (mutt_socket_send(adata.conn, buf_string(buf)) == -1)
-    {
-      rc = SMTP_ERR_WRITE;
-      break;
-    }
-    rc = smtp_get_resp(&adata);
+    rc = smtp_send_cmd(&adata, buf_string(buf));
     if (rc != 0)
       break;
 
@@ -1191,6 +1297,7 @@ int mutt_smtp_send(const struct AddressList *from, const struct AddressList *to,
   mutt_socket_close(adata.conn);
   FREE(&adata.conn);
   FREE(&adata.auth_mechs);
+  buf_pool_release(&adata.pipeline);
 
   if (rc == SMTP_ERR_READ)
     mutt_error(_("SMTP session failed: read error"));
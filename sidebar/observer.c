@@ -341,6 +341,7 @@ static int sb_config_observer(struct NotifyCallback *nc)
   }
 
   // All the remaining config changes...
+  sb_invalidate_entries(sb_wdata_get(win), NULL);
   win->actions |= WA_RECALC;
   mutt_debug(LL_DEBUG5, "config done, request WA_RECALC\n");
   return 0;
@@ -393,6 +394,10 @@ static int sb_mailbox_observer(struct NotifyCallback *nc)
   {
     sb_remove_mailbox(wdata, ev_m->mailbox);
   }
+  else
+  {
+    sb_invalidate_entries(wdata, ev_m->mailbox);
+  }
 
   win->actions |= WA_RECALC;
   mutt_debug(LL_DEBUG5, "mailbox done, request WA_RECALC\n");
@@ -42,6 +42,7 @@ struct SbEntry
   char box[256];                  ///< Mailbox path (possibly abbreviated)
   char display[256];              ///< Formatted string to display
   int depth;                      ///< Indentation depth
+  bool box_valid;                 ///< box and depth are up to date
   struct Mailbox *mailbox;        ///< Mailbox this represents
   bool is_hidden;                 ///< Don't show, e.g. $sidebar_new_mail_only
   const struct AttrColor *color;  ///< Colour to use
@@ -104,6 +105,7 @@ struct SidebarWindowData
 void sb_add_mailbox        (struct SidebarWindowData *wdata, struct Mailbox *m);
 void sb_remove_mailbox     (struct SidebarWindowData *wdata, const struct Mailbox *m);
 void sb_set_current_mailbox(struct SidebarWindowData *wdata, struct Mailbox *m);
+void sb_invalidate_entries (struct SidebarWindowData *wdata, const struct Mailbox *m);
 struct Mailbox *sb_get_highlight(struct MuttWindow *win);
 
 // commands.c
@@ -173,6 +173,24 @@ void sb_remove_mailbox(struct SidebarWindowData *wdata, const struct Mailbox *m)
   }
 }
 
+/**
+ * sb_invalidate_entries - Forget the cached names of Sidebar entries
+ * @param wdata Sidebar data
+ * @param m     Mailbox to forget, or NULL for all of them
+ *
+ * The abbreviated name and depth of each entry will be recalculated the next
+ * time it's displayed.
+ */
+void sb_invalidate_entries(struct SidebarWindowData *wdata, const struct Mailbox *m)
+{
+  struct SbEntry **sbep = NULL;
+  ARRAY_FOREACH(sbep, &wdata->entries)
+  {
+    if (!m || ((*sbep)->mailbox == m))
+      (*sbep)->box_valid = false;
+  }
+}
+
 /**
  * sb_set_current_mailbox - Set the current Mailbox
  * @param wdata Sidebar data
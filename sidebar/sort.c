@@ -38,6 +38,9 @@
 #include "core/lib.h"
 #include "sort.h"
 
+/// Max number of out-of-order entries to fix without a full sort
+#define SB_SORT_FEW 8
+
 /**
  * sb_sort_count - Compare two Sidebar entries by count - Implements ::sort_t - @ingroup sort_api
  */
@@ -147,6 +150,41 @@ static int sb_sort_unsorted(const void *a, const void *b, void *sdata)
   return sort_reverse ? -rc : rc;
 }
 
+/**
+ * sb_sort_nearly_sorted - Sort Sidebar entries that are almost in order
+ * @param wdata Sidebar data
+ * @param fn    Sort function
+ * @param sdata Opaque argument to pass to sort function
+ * @retval true  The entries are sorted
+ * @retval false Too much work, the entries need a full sort
+ *
+ * An insertion sort only moves the entries that are out of place, so it's
+ * quick when just a few Mailboxes have changed.
+ */
+static bool sb_sort_nearly_sorted(struct SidebarWindowData *wdata, sort_t fn, void *sdata)
+{
+  const int num = ARRAY_SIZE(&wdata->entries);
+  long budget = (long) num * SB_SORT_FEW;
+
+  for (int i = 1; i < num; i++)
+  {
+    struct SbEntry *sbe = *ARRAY_GET(&wdata->entries, i);
+    int j = i;
+    for (; (j > 0) && (fn(ARRAY_GET(&wdata->entries, j - 1), &sbe, sdata) > 0); j--)
+    {
+      ARRAY_SET(&wdata->entries, j, *ARRAY_GET(&wdata->entries, j - 1));
+      if (--budget < 0)
+      {
+        ARRAY_SET(&wdata->entries, j - 1, sbe);
+        return false;
+      }
+    }
+    ARRAY_SET(&wdata->entries, j, sbe);
+  }
+
+  return true;
+}
+
 /**
  * sb_sort_entries - Sort the Sidebar entries
  * @param wdata Sidebar data
@@ -156,6 +194,8 @@ static int sb_sort_unsorted(const void *a, const void *b, void *sdata)
  * `$sidebar_sort`. This calls qsort to do the work which calls our
  * callback function "cb_qsort_sbe".
  *
+ * If the entries are already sorted, or nearly so, qsort isn't needed.
+ *
  * Once sorted, the prev/next links will be reconstructed.
  */
 void sb_sort_entries(struct SidebarWindowData *wdata, enum EmailSortType sort)
@@ -186,5 +226,21 @@ void sb_sort_entries(struct SidebarWindowData *wdata, enum EmailSortType sort)
   }
 
   bool sort_reverse = (sort & SORT_REVERSE);
+
+  // Between refreshes, usually only a few counts change, so most of the
+  // entries will already be in order
+  int out_of_order = 0;
+  for (int i = 1; i < ARRAY_SIZE(&wdata->entries); i++)
+  {
+    if (fn(ARRAY_GET(&wdata->entries, i - 1), ARRAY_GET(&wdata->entries, i), &sort_reverse) > 0)
+      out_of_order++;
+  }
+
+  if (out_of_order == 0)
+    return;
+
+  if ((out_of_order <= SB_SORT_FEW) && sb_sort_nearly_sorted(wdata, fn, &sort_reverse))
+    return;
+
   ARRAY_SORT(&wdata->entries, fn, &sort_reverse);
 }
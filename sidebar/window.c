@@ -299,6 +299,55 @@ static int calc_path_depth(const char *mbox, const char *delims, const char **la
   return depth;
 }
 
+/**
+ * update_entry_box - Calculate the name and depth of a Sidebar entry
+ * @param entry Sidebar entry
+ *
+ * Abbreviate the Mailbox's path and work out how far to indent it.
+ * The results are kept until sb_invalidate_entries() is called.
+ */
+static void update_entry_box(struct SbEntry *entry)
+{
+  struct Mailbox *m = entry->mailbox;
+  const char *path = mailbox_path(m);
+
+  const char *const c_folder = cs_subset_string(NeoMutt->sub, "folder");
+  // Try to abbreviate the full path
+  const char *abbr = abbrev_folder(path, c_folder, m->type);
+  if (!abbr)
+    abbr = abbrev_url(path, m->type);
+  const char *short_path = abbr ? abbr : path;
+
+  /* Compute the depth */
+  const char *last_part = abbr;
+  const char *const c_sidebar_delim_chars = cs_subset_string(NeoMutt->sub, "sidebar_delim_chars");
+  entry->depth = calc_path_depth(abbr, c_sidebar_delim_chars, &last_part);
+
+  const bool short_path_is_abbr = (short_path == abbr);
+  const bool c_sidebar_short_path = cs_subset_bool(NeoMutt->sub, "sidebar_short_path");
+  if (c_sidebar_short_path)
+  {
+    short_path = last_part;
+  }
+
+  // Don't indent if we were unable to create an abbreviation.
+  // Otherwise, the full path will be indent, and it looks unusual.
+  const bool c_sidebar_folder_indent = cs_subset_bool(NeoMutt->sub, "sidebar_folder_indent");
+  if (c_sidebar_folder_indent && short_path_is_abbr)
+  {
+    const short c_sidebar_component_depth = cs_subset_number(NeoMutt->sub, "sidebar_component_depth");
+    if (c_sidebar_component_depth > 0)
+      entry->depth -= c_sidebar_component_depth;
+  }
+  else if (!c_sidebar_folder_indent)
+  {
+    entry->depth = 0;
+  }
+
+  mutt_str_copy(entry->box, short_path, sizeof(entry->box));
+  entry->box_valid = true;
+}
+
 /**
  * make_sidebar_entry - Turn mailbox data into a sidebar string
  * @param[out] buf     Buffer in which to save string
@@ -563,42 +612,9 @@ int sb_recalc(struct MuttWindow *win)
       m->msg_flagged = m_cur->msg_flagged;
     }
 
-    const char *path = mailbox_path(m);
-
-    const char *const c_folder = cs_subset_string(NeoMutt->sub, "folder");
-    // Try to abbreviate the full path
-    const char *abbr = abbrev_folder(path, c_folder, m->type);
-    if (!abbr)
-      abbr = abbrev_url(path, m->type);
-    const char *short_path = abbr ? abbr : path;
-
-    /* Compute the depth */
-    const char *last_part = abbr;
-    const char *const c_sidebar_delim_chars = cs_subset_string(NeoMutt->sub, "sidebar_delim_chars");
-    entry->depth = calc_path_depth(abbr, c_sidebar_delim_chars, &last_part);
-
-    const bool short_path_is_abbr = (short_path == abbr);
-    const bool c_sidebar_short_path = cs_subset_bool(NeoMutt->sub, "sidebar_short_path");
-    if (c_sidebar_short_path)
-    {
-      short_path = last_part;
-    }
-
-    // Don't indent if we were unable to create an abbreviation.
-    // Otherwise, the full path will be indent, and it looks unusual.
-    const bool c_sidebar_folder_indent = cs_subset_bool(NeoMutt->sub, "sidebar_folder_indent");
-    if (c_sidebar_folder_indent && short_path_is_abbr)
-    {
-      const short c_sidebar_component_depth = cs_subset_number(NeoMutt->sub, "sidebar_component_depth");
-      if (c_sidebar_component_depth > 0)
-        entry->depth -= c_sidebar_component_depth;
-    }
-    else if (!c_sidebar_folder_indent)
-    {
-      entry->depth = 0;
-    }
+    if (!entry->box_valid)
+      update_entry_box(entry);
 
-    mutt_str_copy(entry->box, short_path, sizeof(entry->box));
     make_sidebar_entry(entry->display, sizeof(entry->display), width, entry, shared);
     row++;
   }
@@ -266,6 +266,35 @@ void test_expando_node_expando(void)
     rc = format_string(buf, 0, 20, JUSTIFY_LEFT, '.', str, len, true);
     TEST_CHECK_NUM_EQ(rc, 1);
 
+    // Printable ASCII
+    strncpy(str, "apple", sizeof(str));
+    len = strlen(str);
+
+    buf_reset(buf);
+    rc = format_string(buf, 0, 3, JUSTIFY_LEFT, '.', str, len, false);
+    TEST_CHECK_NUM_EQ(rc, 3);
+    TEST_CHECK_STR_EQ(buf_string(buf), "app");
+
+    buf_reset(buf);
+    rc = format_string(buf, 8, 20, JUSTIFY_LEFT, '.', str, len, false);
+    TEST_CHECK_NUM_EQ(rc, 8);
+    TEST_CHECK_STR_EQ(buf_string(buf), "apple...");
+
+    buf_reset(buf);
+    rc = format_string(buf, 8, 20, JUSTIFY_RIGHT, '.', str, len, false);
+    TEST_CHECK_NUM_EQ(rc, 8);
+    TEST_CHECK_STR_EQ(buf_string(buf), "...apple");
+
+    buf_reset(buf);
+    rc = format_string(buf, 8, 20, JUSTIFY_CENTER, '.', str, len, false);
+    TEST_CHECK_NUM_EQ(rc, 8);
+    TEST_CHECK_STR_EQ(buf_string(buf), ".apple..");
+
+    buf_reset(buf);
+    rc = format_string(buf, 4, 0, JUSTIFY_LEFT, '.', str, len, false);
+    TEST_CHECK_NUM_EQ(rc, 4);
+    TEST_CHECK_STR_EQ(buf_string(buf), "....");
+
     buf_pool_release(&buf);
   }
 }
@@ -213,15 +213,14 @@ static void dump_node_text(const struct ExpandoNode *node, struct Buffer *buf)
   ASSERT(node->text);
   buf_add_printf(buf, "'%s'", node->text);
 
+  ASSERT(node->ndata);
+  ASSERT(node->ndata_free);
+
   // These shouldn't happen
   // if (node->did != 0)
   //   buf_add_printf(buf, ",did=%d", node->did);
   // if (node->uid != 0)
   //   buf_add_printf(buf, ",uid=%d", node->uid);
-  if (node->ndata)
-    buf_add_printf(buf, ",ndata=%p", node->ndata);
-  if (node->ndata_free)
-    buf_add_printf(buf, ",ndata_free=%p", (void *) (intptr_t) node->ndata_free);
 
   buf_addstr(buf, ">");
 }